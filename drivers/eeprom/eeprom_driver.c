@@ -14,46 +14,222 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// The functions below are layered on top of the driver's own read/write/erase
+#define EEPROM_DRIVER_BACKEND
+
 #include <stdint.h>
 #include <string.h>
 
 #include "eeprom_driver.h"
 
+#ifdef EEPROM_STATS_ENABLE
+#    include "print.h"
+#    include "timer.h"
+#    ifdef EEPROM_WEAR_LEVELING
+#        include "wear_leveling.h"
+#    endif // EEPROM_WEAR_LEVELING
+
+static struct {
+    uint32_t writes;
+    uint32_t skipped_writes;
+    uint32_t bytes_written;
+    uint32_t write_time;
+} eeprom_stats;
+
+static void eeprom_driver_write_block(const void *buf, void *addr, size_t len) {
+    uint32_t start = timer_read32();
+    eeprom_write_block(buf, addr, len);
+    eeprom_stats.write_time += timer_elapsed32(start);
+    eeprom_stats.bytes_written += len;
+    ++eeprom_stats.writes;
+}
+
+#    define eeprom_driver_skipped_write() (++eeprom_stats.skipped_writes)
+#else // EEPROM_STATS_ENABLE
+#    define eeprom_driver_write_block(buf, addr, len) eeprom_write_block(buf, addr, len)
+#    define eeprom_driver_skipped_write() \
+        do {                              \
+        } while (0)
+#endif // EEPROM_STATS_ENABLE
+
+#ifdef EEPROM_ASYNC_ENABLE
+#    include "util.h"
+
+typedef struct PACKED eeprom_async_header_t {
+    uint32_t addr;
+    uint16_t len;
+} eeprom_async_header_t;
+
+// The queue must be able to hold at least one byte of data, otherwise making room for a new entry never completes
+_Static_assert(EEPROM_ASYNC_QUEUE_SIZE > sizeof(eeprom_async_header_t), "EEPROM_ASYNC_QUEUE_SIZE must be larger than a queue entry header");
+_Static_assert(EEPROM_ASYNC_QUEUE_SIZE <= UINT16_MAX, "EEPROM_ASYNC_QUEUE_SIZE must be no larger than 65535");
+
+// Queued writes, each stored as a header followed by its data, oldest first
+static uint8_t  eeprom_async_queue[EEPROM_ASYNC_QUEUE_SIZE];
+static uint16_t eeprom_async_used = 0;
+static uint16_t eeprom_async_last = 0; // offset of the newest entry, only valid if eeprom_async_used > 0
+
+static inline eeprom_async_header_t eeprom_async_get_header(uint16_t offset) {
+    eeprom_async_header_t header;
+    memcpy(&header, &eeprom_async_queue[offset], sizeof(header));
+    return header;
+}
+
+static inline void eeprom_async_set_header(uint16_t offset, eeprom_async_header_t header) {
+    memcpy(&eeprom_async_queue[offset], &header, sizeof(header));
+}
+
+/**
+ * Writes up to max_len bytes of the oldest entry to the driver, removing whatever was written from the queue.
+ */
+static void eeprom_async_write_oldest(uint16_t max_len) {
+    if (eeprom_async_used == 0) {
+        return;
+    }
+
+    eeprom_async_header_t header = eeprom_async_get_header(0);
+    uint16_t              count  = MIN(header.len, max_len);
+    eeprom_driver_write_block(&eeprom_async_queue[sizeof(header)], (void *)(uintptr_t)header.addr, count);
+
+    if (count == header.len) {
+        // Entire entry written, drop it
+        uint16_t size = sizeof(header) + header.len;
+        memmove(&eeprom_async_queue[0], &eeprom_async_queue[size], eeprom_async_used - size);
+        eeprom_async_used -= size;
+        eeprom_async_last = (eeprom_async_last >= size) ? eeprom_async_last - size : 0;
+    } else {
+        // Partially written, drop the written data and move the remainder of the entry along
+        header.addr += count;
+        header.len -= count;
+        eeprom_async_set_header(0, header);
+        memmove(&eeprom_async_queue[sizeof(header)], &eeprom_async_queue[sizeof(header) + count], eeprom_async_used - sizeof(header) - count);
+        eeprom_async_used -= count;
+        eeprom_async_last = (eeprom_async_last > 0) ? eeprom_async_last - count : 0;
+    }
+}
+
+void eeprom_async_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src    = (const uint8_t *)buf;
+    uintptr_t      offset = (uintptr_t)addr;
+
+    while (len > 0) {
+        uint16_t free = EEPROM_ASYNC_QUEUE_SIZE - eeprom_async_used;
+
+        // Coalesce with the newest entry if the write overlaps it or directly follows it
+        if (eeprom_async_used > 0) {
+            eeprom_async_header_t header = eeprom_async_get_header(eeprom_async_last);
+            if (offset >= header.addr && offset <= (uintptr_t)header.addr + header.len) {
+                uint16_t overlap = MIN(len, (uintptr_t)header.addr + header.len - offset);
+                uint16_t extend  = MIN(len - overlap, free);
+                memcpy(&eeprom_async_queue[eeprom_async_last + sizeof(header) + (offset - header.addr)], src, overlap + extend);
+                header.len += extend;
+                eeprom_async_set_header(eeprom_async_last, header);
+                eeprom_async_used += extend;
+                src += overlap + extend;
+                offset += overlap + extend;
+                len -= overlap + extend;
+                if (len == 0) {
+                    break;
+                }
+                free -= extend;
+            }
+        }
+
+        // Make room if there's no space for a new entry
+        if (free <= sizeof(eeprom_async_header_t)) {
+            eeprom_async_write_oldest(EEPROM_ASYNC_QUEUE_SIZE);
+            continue;
+        }
+
+        eeprom_async_header_t header = {.addr = offset, .len = MIN(len, free - sizeof(header))};
+        eeprom_async_set_header(eeprom_async_used, header);
+        memcpy(&eeprom_async_queue[eeprom_async_used + sizeof(header)], src, header.len);
+        eeprom_async_last = eeprom_async_used;
+        eeprom_async_used += sizeof(header) + header.len;
+        src += header.len;
+        offset += header.len;
+        len -= header.len;
+    }
+}
+
+void eeprom_async_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_read_block(buf, addr, len);
+
+    // Overlay queued data, oldest first so that newer writes take precedence
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end   = start + len;
+    for (uint16_t i = 0; i < eeprom_async_used;) {
+        eeprom_async_header_t header      = eeprom_async_get_header(i);
+        uintptr_t             entry_start = header.addr;
+        uintptr_t             entry_end   = entry_start + header.len;
+        if (entry_start < end && entry_end > start) {
+            uintptr_t from = MAX(start, entry_start);
+            uintptr_t to   = MIN(end, entry_end);
+            memcpy((uint8_t *)buf + (from - start), &eeprom_async_queue[i + sizeof(header) + (from - entry_start)], to - from);
+        }
+        i += sizeof(header) + header.len;
+    }
+}
+
+void eeprom_async_erase(void) {
+    eeprom_async_used = 0;
+    eeprom_driver_erase();
+}
+
+void eeprom_driver_task(void) {
+    eeprom_async_write_oldest(EEPROM_ASYNC_WRITE_CHUNK);
+}
+
+void eeprom_driver_flush(void) {
+    while (eeprom_async_used > 0) {
+        eeprom_async_write_oldest(EEPROM_ASYNC_QUEUE_SIZE);
+    }
+}
+
+#    define eeprom_driver_read(buf, addr, len) eeprom_async_read_block(buf, addr, len)
+#    define eeprom_driver_write(buf, addr, len) eeprom_async_write_block(buf, addr, len)
+#else // EEPROM_ASYNC_ENABLE
+#    define eeprom_driver_read(buf, addr, len) eeprom_read_block(buf, addr, len)
+#    define eeprom_driver_write(buf, addr, len) eeprom_driver_write_block(buf, addr, len)
+#endif // EEPROM_ASYNC_ENABLE
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
-    eeprom_read_block(&ret, addr, 1);
+    eeprom_driver_read(&ret, addr, 1);
     return ret;
 }
 
 uint16_t eeprom_read_word(const uint16_t *addr) {
     uint16_t ret = 0;
-    eeprom_read_block(&ret, addr, 2);
+    eeprom_driver_read(&ret, addr, 2);
     return ret;
 }
 
 uint32_t eeprom_read_dword(const uint32_t *addr) {
     uint32_t ret = 0;
-    eeprom_read_block(&ret, addr, 4);
+    eeprom_driver_read(&ret, addr, 4);
     return ret;
 }
 
 void eeprom_write_byte(uint8_t *addr, uint8_t value) {
-    eeprom_write_block(&value, addr, 1);
+    eeprom_driver_write(&value, addr, 1);
 }
 
 void eeprom_write_word(uint16_t *addr, uint16_t value) {
-    eeprom_write_block(&value, addr, 2);
+    eeprom_driver_write(&value, addr, 2);
 }
 
 void eeprom_write_dword(uint32_t *addr, uint32_t value) {
-    eeprom_write_block(&value, addr, 4);
+    eeprom_driver_write(&value, addr, 4);
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
     uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
+    eeprom_driver_read(read_buf, addr, len);
     if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+        eeprom_driver_write(buf, addr, len);
+    } else {
+        eeprom_driver_skipped_write();
     }
 }
 
@@ -61,6 +237,8 @@ void eeprom_update_byte(uint8_t *addr, uint8_t value) {
     uint8_t orig = eeprom_read_byte(addr);
     if (orig != value) {
         eeprom_write_byte(addr, value);
+    } else {
+        eeprom_driver_skipped_write();
     }
 }
 
@@ -68,6 +246,8 @@ void eeprom_update_word(uint16_t *addr, uint16_t value) {
     uint16_t orig = eeprom_read_word(addr);
     if (orig != value) {
         eeprom_write_word(addr, value);
+    } else {
+        eeprom_driver_skipped_write();
     }
 }
 
@@ -75,5 +255,89 @@ void eeprom_update_dword(uint32_t *addr, uint32_t value) {
     uint32_t orig = eeprom_read_dword(addr);
     if (orig != value) {
         eeprom_write_dword(addr, value);
+    } else {
+        eeprom_driver_skipped_write();
+    }
+}
+
+#ifdef EEPROM_STATS_ENABLE
+bool eeprom_driver_get_stat(uint8_t stat, uint8_t index, uint32_t *value) {
+#    ifdef EEPROM_WEAR_LEVELING
+    wear_leveling_stats_t        wl_stats;
+    wear_leveling_region_stats_t wl_region_stats;
+    wear_leveling_get_stats(&wl_stats);
+#    endif // EEPROM_WEAR_LEVELING
+
+    switch (stat) {
+        case EEPROM_STAT_WRITES:
+            *value = eeprom_stats.writes;
+            return true;
+        case EEPROM_STAT_SKIPPED_WRITES:
+            *value = eeprom_stats.skipped_writes;
+            return true;
+        case EEPROM_STAT_BYTES_WRITTEN:
+            *value = eeprom_stats.bytes_written;
+            return true;
+        case EEPROM_STAT_WRITE_TIME:
+            *value = eeprom_stats.write_time;
+            return true;
+#    ifdef EEPROM_WEAR_LEVELING
+        case EEPROM_STAT_WL_LOGICAL_WRITES:
+            *value = wl_stats.logical_writes;
+            return true;
+        case EEPROM_STAT_WL_SKIPPED_WRITES:
+            *value = wl_stats.skipped_writes;
+            return true;
+        case EEPROM_STAT_WL_LOG_ENTRIES:
+            *value = wl_stats.log_entries;
+            return true;
+        case EEPROM_STAT_WL_CONSOLIDATIONS:
+            *value = wl_stats.consolidations;
+            return true;
+        case EEPROM_STAT_WL_ERASES:
+            *value = wl_stats.erases;
+            return true;
+        case EEPROM_STAT_WL_BACKING_TIME:
+            *value = wl_stats.backing_time;
+            return true;
+        case EEPROM_STAT_WL_INIT_TIME:
+            *value = wl_stats.init_time;
+            return true;
+        case EEPROM_STAT_WL_REGION_ERASE_CYCLES:
+            if (!wear_leveling_get_region_stats(index, &wl_region_stats)) {
+                return false;
+            }
+            *value = wl_region_stats.erase_cycles;
+            return true;
+        case EEPROM_STAT_WL_REGION_LOG_FILL:
+            if (!wear_leveling_get_region_stats(index, &wl_region_stats)) {
+                return false;
+            }
+            *value = wl_region_stats.log_fill;
+            return true;
+#    endif // EEPROM_WEAR_LEVELING
+        default:
+            return false;
+    }
+}
+
+void eeprom_driver_reset_stats(void) {
+    memset(&eeprom_stats, 0, sizeof(eeprom_stats));
+#    ifdef EEPROM_WEAR_LEVELING
+    wear_leveling_reset_stats();
+#    endif // EEPROM_WEAR_LEVELING
+}
+
+void eeprom_driver_print_stats(void) {
+    xprintf("eeprom stats:\nwrites: %lu\nskipped_writes: %lu\nbytes_written: %lu\nwrite_time: %lums\n", (unsigned long)eeprom_stats.writes, (unsigned long)eeprom_stats.skipped_writes, (unsigned long)eeprom_stats.bytes_written, (unsigned long)eeprom_stats.write_time);
+#    ifdef EEPROM_WEAR_LEVELING
+    wear_leveling_stats_t        wl_stats;
+    wear_leveling_region_stats_t wl_region_stats;
+    wear_leveling_get_stats(&wl_stats);
+    xprintf("wear_leveling:\nlogical_writes: %lu\nskipped_writes: %lu\nlog_entries: %lu\nconsolidations: %lu\nerases: %lu\nbacking_time: %lums\ninit_time: %lums\n", (unsigned long)wl_stats.logical_writes, (unsigned long)wl_stats.skipped_writes, (unsigned long)wl_stats.log_entries, (unsigned long)wl_stats.consolidations, (unsigned long)wl_stats.erases, (unsigned long)wl_stats.backing_time, (unsigned long)wl_stats.init_time);
+    for (uint8_t i = 0; wear_leveling_get_region_stats(i, &wl_region_stats); ++i) {
+        xprintf("region %u: size %lu/%lu, erase_cycles: %lu, log_fill: %u%%\n", i, (unsigned long)wl_region_stats.logical_size, (unsigned long)wl_region_stats.backing_size, (unsigned long)wl_region_stats.erase_cycles, wl_region_stats.log_fill);
     }
+#    endif // EEPROM_WEAR_LEVELING
 }
+#endif // EEPROM_STATS_ENABLE
@@ -16,7 +16,56 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "eeprom.h"
 
+#if defined(EEPROM_ASYNC_ENABLE) && !defined(EEPROM_DRIVER_BACKEND)
+// Erasing must also discard any queued writes
+#    define eeprom_driver_erase eeprom_async_erase
+#endif
+
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+
+#ifdef EEPROM_ASYNC_ENABLE
+#    ifndef EEPROM_ASYNC_QUEUE_SIZE
+#        define EEPROM_ASYNC_QUEUE_SIZE 256
+#    endif
+#    ifndef EEPROM_ASYNC_WRITE_CHUNK
+#        define EEPROM_ASYNC_WRITE_CHUNK 32
+#    endif
+
+/**
+ * Writes are queued in RAM, and reads are overlaid with any queued data. The queue is written to the driver in chunks
+ * of at most EEPROM_ASYNC_WRITE_CHUNK bytes by eeprom_driver_task(), or in full by eeprom_driver_flush(). Should the
+ * queue fill up, the oldest data is written immediately to make room.
+ */
+void eeprom_driver_task(void);
+void eeprom_driver_flush(void);
+#endif // EEPROM_ASYNC_ENABLE
+
+#ifdef EEPROM_STATS_ENABLE
+/**
+ * Identifiers for the counters retrievable through eeprom_driver_get_stat(). Values are part of the raw HID protocol,
+ * so new entries must only ever be appended.
+ */
+typedef enum eeprom_stat_t {
+    EEPROM_STAT_WRITES = 0,             // writes issued through the eeprom_write_* and eeprom_update_* helpers
+    EEPROM_STAT_SKIPPED_WRITES,         // updates skipped as the data was unchanged
+    EEPROM_STAT_BYTES_WRITTEN,          // bytes written through the helpers
+    EEPROM_STAT_WRITE_TIME,             // milliseconds spent writing through the helpers
+    EEPROM_STAT_WL_LOGICAL_WRITES,      // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_SKIPPED_WRITES,      // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_LOG_ENTRIES,         // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_CONSOLIDATIONS,      // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_ERASES,              // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_BACKING_TIME,        // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_INIT_TIME,           // wear-leveling: see wear_leveling_stats_t
+    EEPROM_STAT_WL_REGION_ERASE_CYCLES, // wear-leveling: erase cycles of the indexed region
+    EEPROM_STAT_WL_REGION_LOG_FILL,     // wear-leveling: write log fill percentage of the indexed region
+} eeprom_stat_t;
+
+bool eeprom_driver_get_stat(uint8_t stat, uint8_t index, uint32_t *value);
+void eeprom_driver_reset_stats(void);
+void eeprom_driver_print_stats(void);
+#endif // EEPROM_STATS_ENABLE
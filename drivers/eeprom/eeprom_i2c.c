@@ -14,6 +14,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define EEPROM_DRIVER_BACKEND
+
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #if defined(EXTERNAL_EEPROM_WP_PIN)
@@ -34,6 +37,8 @@
 */
 
 #include "wait.h"
+#include "timer.h"
+#include "util.h"
 #include "i2c_master.h"
 #include "eeprom.h"
 #include "eeprom_i2c.h"
@@ -41,10 +46,48 @@
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+/*
+    Page writes are not waited upon directly after being issued. Instead, the
+    next access to the EEPROM waits for the previous write cycle to complete,
+    so that the next page can be prepared -- or the caller can continue with
+    other work -- while the EEPROM is busy.
+
+    Completion is determined by polling for an ACK of the EEPROM's I2C address,
+    which most parts withhold until the internal write cycle has finished. If
+    ACK polling is disabled, the full EXTERNAL_EEPROM_WRITE_TIME is waited.
+*/
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+static bool     write_pending = false;
+static uint8_t  write_pending_i2c_address;
+static uint32_t write_pending_start;
+#endif // EXTERNAL_EEPROM_WRITE_TIME > 0
+
+static void wait_for_write_completion(void) {
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    if (!write_pending) {
+        return;
+    }
+
+#    if defined(EXTERNAL_EEPROM_ACK_POLLING_DISABLE)
+    uint32_t elapsed = timer_elapsed32(write_pending_start);
+    if (elapsed < (EXTERNAL_EEPROM_WRITE_TIME)) {
+        wait_ms((EXTERNAL_EEPROM_WRITE_TIME) - elapsed);
+    }
+#    else  // defined(EXTERNAL_EEPROM_ACK_POLLING_DISABLE)
+    while (i2c_ping_address(write_pending_i2c_address, EXTERNAL_EEPROM_WRITE_TIMEOUT) != I2C_STATUS_SUCCESS) {
+        if (timer_elapsed32(write_pending_start) >= (EXTERNAL_EEPROM_WRITE_TIMEOUT)) {
+            break;
+        }
+    }
+#    endif // defined(EXTERNAL_EEPROM_ACK_POLLING_DISABLE)
+
+    write_pending = false;
+#endif // EXTERNAL_EEPROM_WRITE_TIME > 0
+}
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -79,11 +122,32 @@ void eeprom_driver_erase(void) {
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
-    fill_target_address(complete_packet, addr);
+    uint8_t * write_buf   = (uint8_t *)buf;
+    uintptr_t target_addr = (uintptr_t)addr;
+    size_t    remaining   = len; // buf and len are kept intact for the debug output below
+
+    wait_for_write_completion();
 
-    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
-    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+    while (remaining > 0) {
+        // Sequential reads wrap around at the end of the range addressable through each I2C address
+        uint16_t read_length = MIN(remaining, MIN(UINT16_MAX, EXTERNAL_EEPROM_ADDRESS_SPAN - (target_addr % EXTERNAL_EEPROM_ADDRESS_SPAN)));
+        uint16_t timeout     = 100 + read_length / 8; // generous allowance for large transfers, even at 100kHz
+
+#if EXTERNAL_EEPROM_ADDRESS_SIZE == 1
+        i2c_read_register(EXTERNAL_EEPROM_I2C_ADDRESS(target_addr), (uint8_t)target_addr, write_buf, read_length, timeout);
+#elif EXTERNAL_EEPROM_ADDRESS_SIZE == 2
+        i2c_read_register16(EXTERNAL_EEPROM_I2C_ADDRESS(target_addr), (uint16_t)target_addr, write_buf, read_length, timeout);
+#else
+        uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
+        fill_target_address(complete_packet, (const void *)target_addr);
+        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(target_addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+        i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS(target_addr), write_buf, read_length, timeout);
+#endif
+
+        write_buf += read_length;
+        target_addr += read_length;
+        remaining -= read_length;
+    }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
@@ -124,8 +188,14 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+        // The page is ready to go, so now wait for the previous one to finish
+        wait_for_write_completion();
+        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(target_addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+        write_pending             = true;
+        write_pending_i2c_address = EXTERNAL_EEPROM_I2C_ADDRESS(target_addr);
+        write_pending_start       = timer_read32();
+#endif // EXTERNAL_EEPROM_WRITE_TIME > 0
 
         read_buf += write_length;
         target_addr += write_length;
@@ -133,6 +203,9 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     }
 
 #if defined(EXTERNAL_EEPROM_WP_PIN)
+    /* The write cycle must complete before write protection is re-enabled */
+    wait_for_write_completion();
+
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
     gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
@@ -123,3 +123,17 @@
 #ifndef EXTERNAL_EEPROM_WRITE_TIME
 #    define EXTERNAL_EEPROM_WRITE_TIME 5
 #endif
+
+/*
+    The maximum time in milliseconds to wait for a write cycle to complete when
+    polling for an ACK from the EEPROM.
+*/
+#ifndef EXTERNAL_EEPROM_WRITE_TIMEOUT
+#    define EXTERNAL_EEPROM_WRITE_TIMEOUT ((EXTERNAL_EEPROM_WRITE_TIME) * 2)
+#endif
+
+/*
+    The number of bytes addressable through a single I2C address, which bounds
+    the length of a sequential read.
+*/
+#define EXTERNAL_EEPROM_ADDRESS_SPAN (1UL << (8 * (EXTERNAL_EEPROM_ADDRESS_SIZE)))
@@ -1,5 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
+#define EEPROM_DRIVER_BACKEND
+
 #include <stdint.h>
 #include <string.h>
 
@@ -65,33 +65,43 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 // #define DEBUG_FLASH_SPI_OUTPUT
 
+/* Whether a program or erase may still be in progress -- unknown until the status register has been read. */
+static bool spi_flash_busy = true;
+
 static bool spi_flash_start(void) {
     return spi_start(EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN, EXTERNAL_FLASH_SPI_LSBFIRST, EXTERNAL_FLASH_SPI_MODE, EXTERNAL_FLASH_SPI_CLOCK_DIVISOR);
 }
 
 static flash_status_t spi_flash_wait_while_busy(void) {
-    uint32_t       deadline = timer_read32() + EXTERNAL_FLASH_SPI_TIMEOUT;
-    flash_status_t response = FLASH_STATUS_SUCCESS;
-    uint8_t        retval;
-
-    do {
-        bool res = spi_flash_start();
-        if (!res) {
-            dprint("Failed to start SPI! [spi flash wait while busy]\n");
-            return FLASH_STATUS_ERROR;
-        }
+    /* Skip the status register entirely if nothing has been started since the last time the flash was idle. */
+    if (!spi_flash_busy) {
+        return FLASH_STATUS_SUCCESS;
+    }
 
-        spi_write(FLASH_CMD_RDSR);
+    uint32_t       start    = timer_read32();
+    flash_status_t response = FLASH_STATUS_SUCCESS;
 
-        retval = (uint8_t)spi_read();
+    bool res = spi_flash_start();
+    if (!res) {
+        dprint("Failed to start SPI! [spi flash wait while busy]\n");
+        return FLASH_STATUS_ERROR;
+    }
 
-        spi_stop();
+    /* The status register is output continuously for as long as the chip stays selected, so only send RDSR once. */
+    spi_write(FLASH_CMD_RDSR);
 
-        if (timer_read32() >= deadline) {
+    while ((uint8_t)spi_read() & FLASH_FLAG_WIP) {
+        if (timer_elapsed32(start) >= EXTERNAL_FLASH_SPI_TIMEOUT) {
             response = FLASH_STATUS_TIMEOUT;
             break;
         }
-    } while (retval & FLASH_FLAG_WIP);
+    }
+
+    spi_stop();
+
+    if (response == FLASH_STATUS_SUCCESS) {
+        spi_flash_busy = false;
+    }
 
     return response;
 }
@@ -110,30 +120,22 @@ static flash_status_t spi_flash_write_enable(void) {
     return FLASH_STATUS_SUCCESS;
 }
 
-static flash_status_t spi_flash_write_disable(void) {
-    bool res = spi_flash_start();
-    if (!res) {
-        dprint("Failed to start SPI! [spi flash write disable]\n");
-        return FLASH_STATUS_ERROR;
-    }
-
-    spi_write(FLASH_CMD_WRDI);
-
-    spi_stop();
-
-    return FLASH_STATUS_SUCCESS;
-}
-
-/* This function is used for read transfer, write transfer and erase transfer. */
-static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t *data, size_t len) {
+/* Selects the flash and sends the command and address, followed by the dummy bytes required by FAST READ. */
+static flash_status_t spi_flash_send_command(uint8_t cmd, uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
-    uint8_t        buffer[EXTERNAL_FLASH_ADDRESS_SIZE + 1];
+    uint16_t       length   = EXTERNAL_FLASH_ADDRESS_SIZE + 1;
+
+    /* The dummy bytes following the address are don't-care, but are zeroed regardless. */
+    uint8_t buffer[EXTERNAL_FLASH_ADDRESS_SIZE + 1 + EXTERNAL_FLASH_FAST_READ_DUMMY_BYTES] = {0};
 
     buffer[0] = cmd;
     for (int i = 0; i < EXTERNAL_FLASH_ADDRESS_SIZE; ++i) {
         buffer[EXTERNAL_FLASH_ADDRESS_SIZE - i] = addr & 0xFF;
         addr >>= 8;
     }
+    if (cmd == FLASH_CMD_FASTREAD) {
+        length += EXTERNAL_FLASH_FAST_READ_DUMMY_BYTES;
+    }
 
     bool res = spi_flash_start();
     if (!res) {
@@ -141,12 +143,40 @@ static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t
         return FLASH_STATUS_ERROR;
     }
 
-    response = spi_transmit(buffer, sizeof(buffer));
+    response = spi_transmit(buffer, length);
+    if (response) {
+        spi_stop();
+    }
+
+    return response;
+}
+
+/* Receives data within the current transaction, in as many transfers as needed given spi_receive() is limited to 16-bit lengths. */
+static flash_status_t spi_flash_receive(uint8_t *data, size_t len) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    while (len > 0 && !response) {
+        uint16_t chunk = MIN(len, UINT16_MAX);
+        response       = spi_receive(data, chunk);
+        data += chunk;
+        len -= chunk;
+    }
 
-    if ((!response) && (data != NULL)) {
+    return response;
+}
+
+/* This function is used for read transfer, write transfer and erase transfer. */
+static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t *data, size_t len) {
+    flash_status_t response = spi_flash_send_command(cmd, addr);
+    if (response) {
+        return response;
+    }
+
+    if (data != NULL) {
         switch (cmd) {
             case FLASH_CMD_READ:
-                response = spi_receive(data, len);
+            case FLASH_CMD_FASTREAD:
+                response = spi_flash_receive(data, len);
                 break;
             case FLASH_CMD_PP:
                 response = spi_transmit(data, len);
@@ -162,6 +192,10 @@ static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t
     return response;
 }
 
+static uint8_t spi_flash_read_command(void) {
+    return (EXTERNAL_FLASH_FAST_READ) ? FLASH_CMD_FASTREAD : FLASH_CMD_READ;
+}
+
 void flash_init(void) {
     spi_init();
 }
@@ -191,6 +225,7 @@ flash_status_t flash_erase_chip(void) {
     }
     spi_write(FLASH_CMD_CE);
     spi_stop();
+    spi_flash_busy = true;
 
     /* Wait for the write-in-progress bit to be cleared.*/
     response = spi_flash_wait_while_busy();
@@ -206,7 +241,7 @@ flash_status_t flash_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
+    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
         dprintf("Flash erase sector address over limit! [addr:0x%lx]\n", (uint32_t)addr);
         return FLASH_STATUS_ERROR;
     }
@@ -226,7 +261,8 @@ flash_status_t flash_erase_sector(uint32_t addr) {
     }
 
     /* Erase Sector. */
-    response = spi_flash_transaction(FLASH_CMD_SE, addr, NULL, 0);
+    response       = spi_flash_transaction(FLASH_CMD_SE, addr, NULL, 0);
+    spi_flash_busy = true;
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to erase sector! [spi flash erase sector]\n");
         return response;
@@ -246,7 +282,7 @@ flash_status_t flash_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
+    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
         dprintf("Flash erase block address over limit! [addr:0x%lx]\n", (uint32_t)addr);
         return FLASH_STATUS_ERROR;
     }
@@ -266,7 +302,8 @@ flash_status_t flash_erase_block(uint32_t addr) {
     }
 
     /* Erase Block. */
-    response = spi_flash_transaction(FLASH_CMD_BE, addr, NULL, 0);
+    response       = spi_flash_transaction(FLASH_CMD_BE, addr, NULL, 0);
+    spi_flash_busy = true;
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to erase block! [spi flash erase block]\n");
         return response;
@@ -295,7 +332,7 @@ flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len) {
     }
 
     /* Perform read. */
-    response = spi_flash_transaction(FLASH_CMD_READ, addr, read_buf, len);
+    response = spi_flash_transaction(spi_flash_read_command(), addr, read_buf, len);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to read block! [spi flash read block]\n");
         memset(read_buf, 0, len);
@@ -313,6 +350,48 @@ flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len) {
     return response;
 }
 
+flash_status_t flash_read_block_async(uint32_t addr, void *buf, size_t len) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+    uint8_t *      read_buf = (uint8_t *)buf;
+
+    if (len == 0) {
+        return response;
+    }
+
+    /* Wait for the write-in-progress bit to be cleared. */
+    response = spi_flash_wait_while_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to check WIP flag! [spi flash read block async]\n");
+        memset(read_buf, 0, len);
+        return response;
+    }
+
+    response = spi_flash_send_command(spi_flash_read_command(), addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to read block! [spi flash read block async]\n");
+        memset(read_buf, 0, len);
+        return response;
+    }
+
+    /* Anything beyond what a single transfer can handle is received up front, leaving only the final transfer running in the background. */
+    size_t sync_len = len > UINT16_MAX ? len - UINT16_MAX : 0;
+    response        = spi_flash_receive(read_buf, sync_len);
+    if (response == FLASH_STATUS_SUCCESS) {
+        response = spi_receive_async(read_buf + sync_len, len - sync_len);
+    }
+    if (response != FLASH_STATUS_SUCCESS) {
+        spi_stop();
+        dprint("Failed to read block! [spi flash read block async]\n");
+        memset(read_buf, 0, len);
+        return response;
+    }
+
+    /* Deselect the flash as soon as the transfer completes, without waiting for it here. */
+    spi_stop_async();
+
+    return response;
+}
+
 flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
     flash_status_t response  = FLASH_STATUS_SUCCESS;
     uint8_t *      write_buf = (uint8_t *)buf;
@@ -347,7 +426,8 @@ flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
 #endif // DEBUG_FLASH_SPI_OUTPUT
 
         /* Perform the write. */
-        response = spi_flash_transaction(FLASH_CMD_PP, addr, write_buf, write_length);
+        response       = spi_flash_transaction(FLASH_CMD_PP, addr, write_buf, write_length);
+        spi_flash_busy = true;
         if (response != FLASH_STATUS_SUCCESS) {
             dprint("Failed to write block! [spi flash write block]\n");
             return response;
@@ -358,19 +438,6 @@ flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len) {
         len -= write_length;
     }
 
-    /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to check WIP flag! [spi flash write block]\n");
-        return response;
-    }
-
-    /* Disable writes. */
-    response = spi_flash_write_disable();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to write-disable! [spi flash write block]\n");
-        return response;
-    }
-
+    /* The final page program is left to complete in the background; the next operation waits for it if needed. */
     return response;
 }
@@ -63,6 +63,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define EXTERNAL_FLASH_ADDRESS_SIZE 3
 #endif
 
+/*
+    Whether or not reads should use the FAST READ command, which is supported
+    at higher SPI clock speeds than READ.
+*/
+#ifndef EXTERNAL_FLASH_FAST_READ
+#    define EXTERNAL_FLASH_FAST_READ true
+#endif
+
+/*
+    The number of dummy bytes sent between the address and the data of a FAST
+    READ, as specified in the datasheet.
+*/
+#ifndef EXTERNAL_FLASH_FAST_READ_DUMMY_BYTES
+#    define EXTERNAL_FLASH_FAST_READ_DUMMY_BYTES 1
+#endif
+
 /*
     The page size of the FLASH in bytes, as specified in the datasheet.
 */
@@ -129,6 +145,8 @@ flash_status_t flash_erase_sector(uint32_t addr);
 
 flash_status_t flash_read_block(uint32_t addr, void *buf, size_t len);
 
+flash_status_t flash_read_block_async(uint32_t addr, void *buf, size_t len);
+
 flash_status_t flash_write_block(uint32_t addr, const void *buf, size_t len);
 
 #ifdef __cplusplus
@@ -169,3 +169,12 @@ void aw20216s_flush(void) {
     aw20216s_update_pwm_buffers(AW20216S_CS_PIN_2, 1);
 #endif
 }
+
+void aw20216s_sw_return_normal(pin_t cs_pin) {
+    aw20216s_soft_enable(cs_pin);
+}
+
+void aw20216s_sw_shutdown(pin_t cs_pin) {
+    // Clearing CHIPEN stops the outputs, register contents are retained
+    aw20216s_write_register(cs_pin, AW20216S_PAGE_FUNCTION, AW20216S_FUNCTION_REG_CONFIGURATION, AW20216S_CONFIGURATION & ~AW20216S_CONFIGURATION_CHIPEN);
+}
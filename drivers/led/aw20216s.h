@@ -101,6 +101,9 @@ void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index);
 
 void aw20216s_flush(void);
 
+void aw20216s_sw_return_normal(pin_t cs_pin);
+void aw20216s_sw_shutdown(pin_t cs_pin);
+
 #define SW1_CS1 0x00
 #define SW1_CS2 0x01
 #define SW1_CS3 0x02
@@ -217,3 +217,13 @@ void is31fl3729_flush(void) {
         is31fl3729_update_pwm_buffers(i);
     }
 }
+
+void is31fl3729_sw_return_normal(uint8_t index) {
+    // Disable software shutdown.
+    is31fl3729_write_register(index, IS31FL3729_REG_CONFIGURATION, IS31FL3729_CONFIGURATION);
+}
+
+void is31fl3729_sw_shutdown(uint8_t index) {
+    // Enable software shutdown.
+    is31fl3729_write_register(index, IS31FL3729_REG_CONFIGURATION, IS31FL3729_CONFIGURATION & ~0x01);
+}
@@ -243,3 +243,21 @@ void is31fl3731_flush(void) {
         is31fl3731_update_pwm_buffers(i);
     }
 }
+
+void is31fl3731_sw_return_normal(uint8_t index) {
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3731_write_register(index, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x01);
+
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FRAME_1);
+}
+
+void is31fl3731_sw_shutdown(uint8_t index) {
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3731_write_register(index, IS31FL3731_FUNCTION_REG_SHUTDOWN, 0x00);
+
+    is31fl3731_select_page(index, IS31FL3731_COMMAND_FRAME_1);
+}
@@ -278,3 +278,17 @@ void is31fl3733_flush(void) {
         is31fl3733_update_pwm_buffers(i);
     }
 }
+
+void is31fl3733_sw_return_normal(uint8_t index) {
+    is31fl3733_select_page(index, IS31FL3733_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3733_write_register(index, IS31FL3733_FUNCTION_REG_CONFIGURATION, ((driver_sync[index] & 0b11) << 6) | ((IS31FL3733_PWM_FREQUENCY & 0b111) << 3) | 0x01);
+}
+
+void is31fl3733_sw_shutdown(uint8_t index) {
+    is31fl3733_select_page(index, IS31FL3733_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3733_write_register(index, IS31FL3733_FUNCTION_REG_CONFIGURATION, ((driver_sync[index] & 0b11) << 6) | ((IS31FL3733_PWM_FREQUENCY & 0b111) << 3));
+}
@@ -255,3 +255,17 @@ void is31fl3736_flush(void) {
         is31fl3736_update_pwm_buffers(i);
     }
 }
+
+void is31fl3736_sw_return_normal(uint8_t index) {
+    is31fl3736_select_page(index, IS31FL3736_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3736_write_register(index, IS31FL3736_FUNCTION_REG_CONFIGURATION, ((IS31FL3736_PWM_FREQUENCY & 0b111) << 3) | 0x01);
+}
+
+void is31fl3736_sw_shutdown(uint8_t index) {
+    is31fl3736_select_page(index, IS31FL3736_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3736_write_register(index, IS31FL3736_FUNCTION_REG_CONFIGURATION, ((IS31FL3736_PWM_FREQUENCY & 0b111) << 3));
+}
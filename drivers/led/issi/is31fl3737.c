@@ -250,3 +250,17 @@ void is31fl3737_flush(void) {
         is31fl3737_update_pwm_buffers(i);
     }
 }
+
+void is31fl3737_sw_return_normal(uint8_t index) {
+    is31fl3737_select_page(index, IS31FL3737_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3737_write_register(index, IS31FL3737_FUNCTION_REG_CONFIGURATION, ((IS31FL3737_PWM_FREQUENCY & 0b111) << 3) | 0x01);
+}
+
+void is31fl3737_sw_shutdown(uint8_t index) {
+    is31fl3737_select_page(index, IS31FL3737_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3737_write_register(index, IS31FL3737_FUNCTION_REG_CONFIGURATION, ((IS31FL3737_PWM_FREQUENCY & 0b111) << 3));
+}
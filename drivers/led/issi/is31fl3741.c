@@ -288,3 +288,17 @@ void is31fl3741_flush(void) {
         is31fl3741_update_pwm_buffers(i);
     }
 }
+
+void is31fl3741_sw_return_normal(uint8_t index) {
+    is31fl3741_select_page(index, IS31FL3741_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3741_write_register(index, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION);
+}
+
+void is31fl3741_sw_shutdown(uint8_t index) {
+    is31fl3741_select_page(index, IS31FL3741_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3741_write_register(index, IS31FL3741_FUNCTION_REG_CONFIGURATION, IS31FL3741_CONFIGURATION & ~0x01);
+}
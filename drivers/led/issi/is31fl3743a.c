@@ -247,3 +247,17 @@ void is31fl3743a_flush(void) {
         is31fl3743a_update_pwm_buffers(i);
     }
 }
+
+void is31fl3743a_sw_return_normal(uint8_t index) {
+    is31fl3743a_select_page(index, IS31FL3743A_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3743a_write_register(index, IS31FL3743A_FUNCTION_REG_CONFIGURATION, IS31FL3743A_CONFIGURATION);
+}
+
+void is31fl3743a_sw_shutdown(uint8_t index) {
+    is31fl3743a_select_page(index, IS31FL3743A_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3743a_write_register(index, IS31FL3743A_FUNCTION_REG_CONFIGURATION, IS31FL3743A_CONFIGURATION & ~0x01);
+}
@@ -247,3 +247,17 @@ void is31fl3745_flush(void) {
         is31fl3745_update_pwm_buffers(i);
     }
 }
+
+void is31fl3745_sw_return_normal(uint8_t index) {
+    is31fl3745_select_page(index, IS31FL3745_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3745_write_register(index, IS31FL3745_FUNCTION_REG_CONFIGURATION, IS31FL3745_CONFIGURATION);
+}
+
+void is31fl3745_sw_shutdown(uint8_t index) {
+    is31fl3745_select_page(index, IS31FL3745_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3745_write_register(index, IS31FL3745_FUNCTION_REG_CONFIGURATION, IS31FL3745_CONFIGURATION & ~0x01);
+}
@@ -224,3 +224,17 @@ void is31fl3746a_flush(void) {
         is31fl3746a_update_pwm_buffers(i);
     }
 }
+
+void is31fl3746a_sw_return_normal(uint8_t index) {
+    is31fl3746a_select_page(index, IS31FL3746A_COMMAND_FUNCTION);
+
+    // Disable software shutdown.
+    is31fl3746a_write_register(index, IS31FL3746A_FUNCTION_REG_CONFIGURATION, IS31FL3746A_CONFIGURATION);
+}
+
+void is31fl3746a_sw_shutdown(uint8_t index) {
+    is31fl3746a_select_page(index, IS31FL3746A_COMMAND_FUNCTION);
+
+    // Enable software shutdown.
+    is31fl3746a_write_register(index, IS31FL3746A_FUNCTION_REG_CONFIGURATION, IS31FL3746A_CONFIGURATION & ~0x01);
+}
@@ -5,6 +5,7 @@
 
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
+#    include "qp_draw.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
@@ -33,11 +34,33 @@ bool qp_comms_spi_start(painter_device_t device) {
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
-    const uint32_t max_msg_length  = 1024;
+    uint32_t       max_msg_length  = 1024;
+
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Only the pixdata buffers are guaranteed to be left untouched until the transfer completes, anything else
+    // (such as command parameters on the stack) needs to be sent synchronously.
+    bool async = qp_internal_is_pixdata_buffer(data);
+    if (async) {
+        // Each transfer waits for the previous one, so send as much as possible at once to avoid stalling the caller
+        max_msg_length = UINT16_MAX;
+    }
+#    endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 
     while (bytes_remaining > 0) {
-        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
-        spi_transmit(p, bytes_this_loop);
+        uint32_t     bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
+        spi_status_t status;
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA
+        if (async) {
+            status = spi_transmit_async(p, bytes_this_loop);
+        } else
+#    endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+        {
+            status = spi_transmit(p, bytes_this_loop);
+        }
+        if (status != SPI_STATUS_SUCCESS) {
+            // Report how much was sent, so the caller can detect the failure
+            break;
+        }
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
     }
@@ -46,17 +69,31 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
 }
 
 void qp_comms_spi_stop(painter_device_t device) {
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // Let any in-flight pixel data complete in the background, the SPI driver releases chip select once it's done
+    spi_stop_async();
+#    else  // QUANTUM_PAINTER_ASYNC_PIXDATA
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
     spi_stop();
     gpio_write_pin_high(comms_config->chip_select_pin);
+#    endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 }
 
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA
+bool qp_comms_spi_busy(painter_device_t device) {
+    return spi_busy();
+}
+#    endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
 const painter_comms_vtable_t spi_comms_vtable = {
     .comms_init  = qp_comms_spi_init,
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if QUANTUM_PAINTER_ASYNC_PIXDATA
+    .comms_busy  = qp_comms_spi_busy,
+#    endif // QUANTUM_PAINTER_ASYNC_PIXDATA
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,6 +137,10 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    // Any pixel data still being transmitted needs D/C to remain high until it's done
+    if (spi_wait() != SPI_STATUS_SUCCESS) {
+        return;
+    }
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -135,6 +176,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if QUANTUM_PAINTER_ASYNC_PIXDATA
+            .comms_busy  = qp_comms_spi_busy,
+#        endif // QUANTUM_PAINTER_ASYNC_PIXDATA
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
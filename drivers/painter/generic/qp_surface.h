@@ -21,6 +21,23 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty rectangles each surface tracks.
+ *      Unrelated updates in different areas of the surface are transferred as separate rectangles instead of one
+ *      large bounding box. Once every slot is in use, the rectangles which waste the least area are merged.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_RECT_MERGE_DISTANCE
+/**
+ * @def This controls how close (in pixels) a modified pixel needs to be to an existing dirty rectangle for that
+ *      rectangle to be grown to include it, rather than starting a new rectangle.
+ */
+#    define SURFACE_DIRTY_RECT_MERGE_DISTANCE 8
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -53,7 +70,8 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Each dirty rectangle is sent to the target as its own viewport and pixel data transfer. After successful completion,
+ * the dirty area is reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
@@ -29,24 +29,106 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (rect->b - rect->t + 1);
+}
+
+static inline void dirty_rect_union(surface_dirty_rect_t *out, const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    out->l = MIN(a->l, b->l);
+    out->t = MIN(a->t, b->t);
+    out->r = MAX(a->r, b->r);
+    out->b = MAX(a->b, b->b);
+}
+
+// Area that would be transferred unnecessarily if the two rectangles were sent as their bounding box instead
+static inline int32_t dirty_rect_merge_cost(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t u;
+    dirty_rect_union(&u, a, b);
+    return (int32_t)dirty_rect_area(&u) - (int32_t)dirty_rect_area(a) - (int32_t)dirty_rect_area(b);
+}
+
+// Merges rectangle `from` into rectangle `into`, returning the new index of `into`
+static uint8_t dirty_rect_merge(surface_dirty_data_t *dirty, uint8_t into, uint8_t from) {
+    dirty_rect_union(&dirty->rects[into], &dirty->rects[into], &dirty->rects[from]);
+
+    // Fill the hole with the last rectangle
+    dirty->rects[from] = dirty->rects[--dirty->count];
+    return (into == dirty->count) ? from : into;
+}
+
+// Folds any rectangles which are cheaper to send as one into the rectangle that just grew
+static void dirty_rect_coalesce(surface_dirty_data_t *dirty, uint8_t index) {
+    for (uint8_t i = 0; i < dirty->count;) {
+        if (i != index && dirty_rect_merge_cost(&dirty->rects[index], &dirty->rects[i]) <= 0) {
+            index = dirty_rect_merge(dirty, index, i);
+            i     = 0;
+        } else {
+            ++i;
+        }
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    dirty->is_dirty = true;
+
+    // Nothing to do if the pixel is already covered
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b) {
+            return;
+        }
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+
+    surface_dirty_rect_t pixel = {.l = x, .t = y, .r = x, .b = y};
+
+    // Grow a nearby rectangle if there is one
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x + SURFACE_DIRTY_RECT_MERGE_DISTANCE >= rect->l && x <= rect->r + SURFACE_DIRTY_RECT_MERGE_DISTANCE && y + SURFACE_DIRTY_RECT_MERGE_DISTANCE >= rect->t && y <= rect->b + SURFACE_DIRTY_RECT_MERGE_DISTANCE) {
+            dirty_rect_union(rect, rect, &pixel);
+            dirty_rect_coalesce(dirty, i);
+            return;
+        }
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+
+    // Otherwise start a new rectangle, making room first if all of them are in use
+    if (dirty->count == SURFACE_DIRTY_RECTS) {
+        int32_t best_cost = INT32_MAX;
+        uint8_t best_into = 0;
+        uint8_t best_from = UINT8_MAX;
+        for (uint8_t i = 0; i < dirty->count; ++i) {
+            int32_t cost = dirty_rect_merge_cost(&dirty->rects[i], &pixel);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_into = i;
+                best_from = UINT8_MAX;
+            }
+            for (uint8_t j = i + 1; j < dirty->count; ++j) {
+                cost = dirty_rect_merge_cost(&dirty->rects[i], &dirty->rects[j]);
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_into = i;
+                    best_from = j;
+                }
+            }
+        }
+
+        if (best_from == UINT8_MAX) {
+            // Cheapest to absorb the pixel into an existing rectangle
+            dirty_rect_union(&dirty->rects[best_into], &dirty->rects[best_into], &pixel);
+            dirty_rect_coalesce(dirty, best_into);
+            return;
+        }
+
+        dirty_rect_coalesce(dirty, dirty_rect_merge(dirty, best_into, best_from));
     }
+
+    dirty->rects[dirty->count++] = pixel;
+}
+
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty) {
+    dirty->count    = 0;
+    dirty->is_dirty = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +139,12 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.rects[0].l = 0;
+    surface->dirty.rects[0].t = 0;
+    surface->dirty.rects[0].r = surface->base.panel_width - 1;
+    surface->dirty.rects[0].b = surface->base.panel_height - 1;
+    surface->dirty.count      = 1;
+    surface->dirty.is_dirty   = true;
 
     return true;
 }
@@ -80,9 +163,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_reset_dirty(&surface->dirty);
     return true;
 }
 
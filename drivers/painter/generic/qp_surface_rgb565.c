@@ -68,13 +68,11 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+static bool rgb565_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
+    uint16_t l = rect->l;
+    uint16_t t = rect->t;
+    uint16_t r = rect->r;
+    uint16_t b = rect->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
@@ -84,7 +82,8 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    qp_internal_acquire_pixdata_buffer();
+    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_handle->base.native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
@@ -101,7 +100,9 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Continue filling the other buffer while this one is sent, and reset the counter
+                qp_internal_swap_pixdata_buffer();
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
                 pixel_counter = 0;
             }
         }
@@ -114,6 +115,25 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
             qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
+    }
+
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        surface_dirty_rect_t rect = {.l = 0, .t = 0, .r = surface_handle->base.panel_width - 1, .b = surface_handle->base.panel_height - 1};
+        return rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &rect);
+    }
+
+    // Send each dirty rectangle as its own viewport + pixdata burst
+    for (uint8_t i = 0; i < surface_handle->dirty.count; ++i) {
+        if (!rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &surface_handle->dirty.rects[i])) {
+            return false;
+        }
     }
 
     return true;
@@ -58,15 +58,15 @@ bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *tar
 // Flush helpers
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void page_column_flush_rect_rot0(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
-    int min_page   = dirty->t / 8;
-    int max_page   = dirty->b / 8;
-    int min_column = dirty->l;
-    int max_column = dirty->r;
+    int min_page   = rect->t / 8;
+    int max_page   = rect->b / 8;
+    int min_column = rect->l;
+    int max_column = rect->r;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -91,16 +91,16 @@ void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty
     }
 }
 
-void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void page_column_flush_rect_rot90(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_columns = driver->panel_width;
-    int min_page    = dirty->l / 8;
-    int max_page    = dirty->r / 8;
-    int min_column  = dirty->t;
-    int max_column  = dirty->b;
+    int min_page    = rect->l / 8;
+    int max_page    = rect->r / 8;
+    int min_column  = rect->t;
+    int max_column  = rect->b;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -125,17 +125,17 @@ void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirt
     }
 }
 
-void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void page_column_flush_rect_rot180(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_pages   = driver->panel_height / 8;
     int num_columns = driver->panel_width;
-    int min_page    = dirty->t / 8;
-    int max_page    = dirty->b / 8;
-    int min_column  = dirty->l;
-    int max_column  = dirty->r;
+    int min_page    = rect->t / 8;
+    int max_page    = rect->b / 8;
+    int min_column  = rect->l;
+    int max_column  = rect->r;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -160,16 +160,16 @@ void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dir
     }
 }
 
-void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+static void page_column_flush_rect_rot270(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer) {
     painter_driver_t *                  driver = (painter_driver_t *)device;
     oled_panel_painter_driver_vtable_t *vtable = (oled_panel_painter_driver_vtable_t *)driver->driver_vtable;
 
     // TODO: account for offset_x/y in base driver
     int num_pages  = driver->panel_height / 8;
-    int min_page   = dirty->l / 8;
-    int max_page   = dirty->r / 8;
-    int min_column = dirty->t;
-    int max_column = dirty->b;
+    int min_page   = rect->l / 8;
+    int max_page   = rect->r / 8;
+    int min_column = rect->t;
+    int max_column = rect->b;
 
     for (int page = min_page; page <= max_page; ++page) {
         int     cols_required = max_column - min_column + 1;
@@ -193,3 +193,25 @@ void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dir
         qp_comms_send(device, column_data, cols_required);
     }
 }
+
+static void qp_oled_panel_page_column_flush_rects(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer, void (*flush_rect)(painter_device_t device, const surface_dirty_rect_t *rect, const uint8_t *framebuffer)) {
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        flush_rect(device, &dirty->rects[i], framebuffer);
+    }
+}
+
+void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    qp_oled_panel_page_column_flush_rects(device, dirty, framebuffer, page_column_flush_rect_rot0);
+}
+
+void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    qp_oled_panel_page_column_flush_rects(device, dirty, framebuffer, page_column_flush_rect_rot90);
+}
+
+void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    qp_oled_panel_page_column_flush_rects(device, dirty, framebuffer, page_column_flush_rect_rot180);
+}
+
+void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    qp_oled_panel_page_column_flush_rects(device, dirty, framebuffer, page_column_flush_rect_rot270);
+}
@@ -8,7 +8,7 @@
 #include "wear_leveling_internal.h"
 
 #ifndef WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
-#    define WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT 32
+#    define WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT ((EXTERNAL_FLASH_PAGE_SIZE) / sizeof(backing_store_int_t))
 #endif // WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
 
 bool backing_store_init(void) {
@@ -41,6 +41,25 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    return address % (EXTERNAL_FLASH_SECTOR_SIZE) == 0 && length % (EXTERNAL_FLASH_SECTOR_SIZE) == 0;
+}
+
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    if (!backing_store_range_erasable(address, length)) {
+        bs_dprintf("Erase range is not aligned to sector boundaries\n");
+        return false;
+    }
+
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    for (uint32_t i = 0; i < length; i += (EXTERNAL_FLASH_SECTOR_SIZE)) {
+        if (flash_erase_sector(offset + i) != FLASH_STATUS_SUCCESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -69,12 +88,13 @@ bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size
 }
 
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
-    uint32_t            offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
-    size_t              index  = 0;
-    backing_store_int_t temp[WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT];
+    uint32_t                   offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    size_t                     index  = 0;
+    static backing_store_int_t temp[WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT];
     do {
-        // Copy out the block of data we want to transmit first
-        size_t this_loop = MIN(item_count, WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT);
+        // Copy out the block of data we want to transmit first, stopping at the end of the current page so that each chunk is a single page program
+        size_t page_remaining = ((EXTERNAL_FLASH_PAGE_SIZE) - (offset % (EXTERNAL_FLASH_PAGE_SIZE))) / sizeof(backing_store_int_t);
+        size_t this_loop      = MIN(MIN(item_count, WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT), page_remaining);
         for (size_t i = 0; i < this_loop; ++i) {
             temp[i] = values[index + i];
         }
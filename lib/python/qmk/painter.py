@@ -341,6 +341,8 @@ def convert_image_bytes(im, format):
         # Export the palette
         palette = []
         pal = im.getpalette()
+        # Images with fewer colors than requested (e.g. small delta frames) may have a shorter palette, pad it out
+        pal = pal + [0] * max(0, ncolors * 3 - len(pal))
         for n in range(0, ncolors * 3, 3):
             palette.append((pal[n + 0], pal[n + 1], pal[n + 2]))
 
@@ -430,3 +432,75 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def compress_bytes_qmk_lz(bytearray):
+    window_size = 256
+    min_match = 3
+    max_match = 130
+    max_literals = 128
+
+    output = []
+    literals = []
+    candidates = {}
+
+    def flush_literals():
+        while len(literals) > 0:
+            run = literals[0:max_literals]
+            output.append(len(run) - 1)
+            output.extend(run)
+            del literals[0:max_literals]
+
+    def add_candidate(pos):
+        if pos + min_match <= len(bytearray):
+            key = bytes(bytearray[pos:pos + min_match])
+            positions = candidates.setdefault(key, [])
+            positions.append(pos)
+            # Drop anything that's fallen out of the window
+            while pos - positions[0] >= window_size:
+                positions.pop(0)
+
+    n = 0
+    while n < len(bytearray):
+        # Find the longest match within the window, preferring the closest
+        best_length = 0
+        best_distance = 0
+        for pos in reversed(candidates.get(bytes(bytearray[n:n + min_match]), [])):
+            distance = n - pos
+            if distance > window_size:
+                break
+            length = 0
+            while length < max_match and n + length < len(bytearray) and bytearray[pos + length] == bytearray[n + length]:
+                length += 1
+            if length > best_length:
+                best_length = length
+                best_distance = distance
+                if length == max_match:
+                    break
+
+        if best_length >= min_match:
+            flush_literals()
+            output.append(128 + best_length - min_match)
+            output.append(best_distance - 1)
+            advance = best_length
+        else:
+            literals.append(bytearray[n])
+            advance = 1
+
+        for pos in range(n, n + advance):
+            add_candidate(pos)
+        n += advance
+
+    flush_literals()
+    return output
+
+
+def compress_bytes_smallest(bytearray, *, use_rle=True, use_lz=True):
+    """Returns the smallest encoding of the supplied bytes, as a tuple of (painter_compression_t, data).
+    """
+    options = [(0x00, bytearray)]  # See qp.h, painter_compression_t
+    if use_rle:
+        options.append((0x01, compress_bytes_qmk_rle(bytearray)))
+    if use_lz:
+        options.append((0x02, compress_bytes_qmk_lz(bytearray)))
+    return min(options, key=lambda x: len(x[1]))
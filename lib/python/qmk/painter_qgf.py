@@ -8,7 +8,7 @@
 import functools
 from colorsys import rgb_to_hsv
 from types import FunctionType
-from PIL import Image, ImageFile, ImageChops
+from PIL import Image, ImageFile, ImageChops, ImageOps
 from PIL._binary import o8, o16le as o16, o32le as o32
 import qmk.painter
 
@@ -260,24 +260,37 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
-def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
+def _visible_frame(frame, format_):
+    """Reduces a frame to the precision it's displayed at, so that changes which can't be seen once converted aren't treated as changes.
+    """
+    if format_['image_format'] == 'IMAGE_FORMAT_GRAYSCALE':
+        maxval = format_['num_colors'] - 1
+        return ImageOps.grayscale(frame).point(lambda v: qmk.painter.rescale_byte(v, maxval))
+    if format_['image_format'] == 'IMAGE_FORMAT_RGB565':
+        # Per-channel lookup tables, dropping the bits that don't survive conversion to 5-6-5
+        return frame.point([v & 0xF8 for v in range(256)] + [v & 0xFC for v in range(256)] + [v & 0xF8 for v in range(256)])
+    # Palettes are generated per-frame, so compare the original colors
+    return frame
+
+
+def _frames_look_identical(frame, other_frame, format_):
+    return ImageChops.difference(_visible_frame(frame, format_), _visible_frame(other_frame, format_)).getbbox() is None
+
+
+def _compress_image(frame, last_frame, *, use_rle, use_lz, use_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
 
-    # Convert the raw data to RLE-encoded if requested
-    raw_data = graphic_data[1]
-    if use_rle:
-        rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-    use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-    image_data = raw_data if use_raw_this_frame else rle_data
+    # Pick whichever of raw, RLE-encoded or LZ-encoded data is smallest, as requested
+    (compression, image_data) = qmk.painter.compress_bytes_smallest(graphic_data[1], use_rle=use_rle, use_lz=use_lz)
 
     # Work out if a delta frame is smaller than injecting it directly
     use_delta_this_frame = False
     bbox = None
     if use_deltas and last_frame is not None:
-        # If we want to use deltas, then find the difference
-        diff = ImageChops.difference(frame, last_frame)
+        # If we want to use deltas, then find the difference that'll actually be visible
+        diff = ImageChops.difference(_visible_frame(frame, format_), _visible_frame(last_frame, format_))
 
         # Get the bounding box of those differences
         bbox = diff.getbbox()
@@ -292,11 +305,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
             delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
 
             # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
+            (delta_compression, delta_image_data) = qmk.painter.compress_bytes_smallest(delta_graphic_data[1], use_rle=use_rle, use_lz=use_lz)
 
             # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
             # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
@@ -304,9 +313,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
             if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
                 # Copy across all the delta equivalents so that the rest of the processing acts on those
                 graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
+                compression = delta_compression
                 image_data = delta_image_data
                 use_delta_this_frame = True
 
@@ -322,7 +329,7 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
         "graphic_data": graphic_data,
         "image_data": image_data,
         "use_delta_this_frame": use_delta_this_frame,
-        "use_raw_this_frame": use_raw_this_frame,
+        "compression": compression,
     }
 
 
@@ -332,13 +339,13 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     # This would cause an issue with `_compress_image(**kwargs)` missing an argument
     format_ = kwargs["format_"]
 
-    # (potentially) Apply RLE and/or delta, and work out output image's information
+    # (potentially) Apply RLE/LZ and/or delta, and work out output image's information
     outputs = _compress_image(frame, last_frame, **kwargs)
     bbox = outputs["bbox"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
     use_delta_this_frame = outputs["use_delta_this_frame"]
-    use_raw_this_frame = outputs["use_raw_this_frame"]
+    compression = outputs["compression"]
 
     # Write out the frame descriptor
     frame_offsets.frame_offsets[idx] = fp.tell()
@@ -347,7 +354,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
     frame_descriptor.is_delta = use_delta_this_frame
     frame_descriptor.is_transparent = False
     frame_descriptor.format = format_['image_format_byte']
-    frame_descriptor.compression = 0x00 if use_raw_this_frame else 0x01  # See qp.h, painter_compression_t
+    frame_descriptor.compression = compression  # See qp.h, painter_compression_t
     frame_descriptor.delay = frame.info.get('duration', 1000)  # If we're not an animation, just pretend we're delaying for 1000ms
     frame_descriptor.write(fp)
 
@@ -420,11 +427,27 @@ def _save(im, fp, _filename):
     if len(set(frame_sizes)) != 1:
         raise ValueError("Mismatching sizes on frames")
 
+    # Collect all the frames. When using deltas, a frame which looks identical to the one before it is folded into the
+    # previous frame's duration instead, as redrawing it would change nothing on the display
+    format_ = encoderinfo["qmk_format"]
+    use_deltas = encoderinfo.get("use_deltas", True)
+    frames = []
+
+    def collect_frame(_idx, frame, _last_frame):
+        if use_deltas and len(frames) > 0:
+            duration = frames[-1].info.get('duration', 1000) + frame.info.get('duration', 1000)
+            if duration <= 0xFFFF and _frames_look_identical(frame, frames[-1], format_):
+                frames[-1].info['duration'] = duration
+                return
+        frames.append(frame)
+
+    for_all_frames(collect_frame)
+
     # Write out the initial graphics descriptor (and write a dummy value), so that we can come back and fill in the
     # correct values once we've written all the frames to the output
     graphics_descriptor_location = fp.tell()
     graphics_descriptor = QGFGraphicsDescriptor()
-    graphics_descriptor.frame_count = len(frame_sizes)
+    graphics_descriptor.frame_count = len(frames)
     graphics_descriptor.image_size = frame_sizes[0]
     vprint(f'{"Graphics descriptor block":26s} {fp.tell():5d}d / {fp.tell():04X}h')
     graphics_descriptor.write(fp)
@@ -437,8 +460,11 @@ def _save(im, fp, _filename):
     frame_offsets.write(fp)
 
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
-    for_all_frames(write_frame)
+    write_frame = functools.partial(_write_frame, format_=format_, fp=fp, use_deltas=use_deltas, use_rle=encoderinfo.get("use_rle", True), use_lz=encoderinfo.get("use_lz", True), frame_offsets=frame_offsets, metadata=metadata)
+    last_frame = None
+    for idx, frame in enumerate(frames):
+        write_frame(idx, frame, last_frame)
+        last_frame = frame
 
     # Go back and update the graphics descriptor now that we can determine the final file size
     graphics_descriptor.total_file_size = fp.tell()
@@ -151,6 +151,19 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+// No DMA available, so asynchronous transfers complete before returning
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+spi_status_t spi_wait(void) {
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_busy(void) {
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -167,6 +180,10 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length) {
+    return spi_receive(data, length);
+}
+
 void spi_stop(void) {
     if (currentSlavePin != NO_PIN) {
         gpio_set_pin_output(currentSlavePin);
@@ -178,3 +195,7 @@ void spi_stop(void) {
         currentSlave2X     = false;
     }
 }
+
+void spi_stop_async(void) {
+    spi_stop();
+}
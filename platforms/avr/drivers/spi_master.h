@@ -51,9 +51,19 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+spi_status_t spi_wait(void);
+
+bool spi_busy(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length);
+
 void spi_stop(void);
+
+void spi_stop_async(void);
 #ifdef __cplusplus
 }
 #endif
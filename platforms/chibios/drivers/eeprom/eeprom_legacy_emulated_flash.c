@@ -18,6 +18,8 @@
  * Modifications to increase flash density by Don Kjer
  */
 
+#define EEPROM_DRIVER_BACKEND
+
 #include <stdio.h>
 #include <stdbool.h>
 #include "util.h"
@@ -83,6 +85,7 @@
  * *** Write Log Structure ***
  *
  * Write log entries allow for optimized byte writes to addresses below 128. Writing 0 or 1 words are also optimized when word-aligned.
+ * Contiguous runs of words written through eeprom_write_block() may instead be logged as a single Word-Block entry, when smaller.
  *
  * === WRITE LOG ENTRY FORMATS ===
  *
@@ -109,9 +112,14 @@
  * ╚════════════════╝
  * 0 <= Address <= 0x3FFE (16382)
  *
- * ╔═══ Reserved ═══╗
- * ║110XXXXXXXXXXXXX║
- * ╚════════════════╝
+ * ╔════════════════════════ Word-Block ═════════════════════════╗
+ * ║110XXXXXXXXXXXXX║NNNNNNNNNNNNNNNN║YYYYYYYYYYYYYYYY║CCCCCCCCCCCCCCCC║
+ * ║   └─────┬─────┘║└───────┬──────┘║└───────┬──────┘║└───────┬──────┘║
+ * ║  Address >> 1  ║  Word count N  ║  ~Value (x N)  ║  Check value   ║
+ * ╚════════════════╩════════════════╩════════════════╩════════════════╝
+ * 0 <= Address <= 0x3FFE (16382)
+ * The check value covers the address, count and values, so that an incomplete
+ * write is detected and the whole entry skipped.
  *
  * ╔═══════════ Word-Next ═══════════╗
  * ║111XXXXXXXXXXXXX║YYYYYYYYYYYYYYYY║
@@ -125,7 +133,7 @@
  * 0x0000 ... 0x7FFF - Byte-Entry;     address is (Entry & 0x7F00) >> 4; value is (Entry & 0xFF)
  * 0x8000 ... 0x9FFF - Word-Encoded 0; address is (Entry & 0x1FFF) << 1; value is 0
  * 0xA000 ... 0xBFFF - Word-Encoded 1; address is (Entry & 0x1FFF) << 1; value is 1
- * 0xC000 ... 0xDFFF - Reserved
+ * 0xC000 ... 0xDFFF - Word-Block;     address is (Entry & 0x1FFF) << 1; count is Next_Entry; values are ~(following N entries)
  * 0xE000 ... 0xFFBF - Word-Next;      address is (Entry & 0x1FFF) << 1 + 0x80; value is ~(Next_Entry)
  * 0xFFC0 ... 0xFFFE - Reserved
  * 0xFFFF            - Unprogrammed
@@ -137,6 +145,7 @@
 #define FEE_WORD_ENCODING 0x8000
 #define FEE_VALUE_NEXT 0x6000
 #define FEE_VALUE_RESERVED 0x4000
+#define FEE_VALUE_BLOCK 0x4000
 #define FEE_VALUE_ENCODED 0x2000
 #define FEE_BYTE_RANGE 0x80
 
@@ -213,10 +222,26 @@ void print_eeprom(void) {
 #endif
 }
 
+/* Check value of a Word-Block log entry, covering the header, count and stored values */
+static uint16_t eeprom_block_check(const uint16_t *entry, uint16_t count) {
+    uint16_t sum1 = 0x5AA5;
+    uint16_t sum2 = 0;
+    for (uint16_t i = 0; i < count + 2; ++i) {
+        sum1 += entry[i];
+        sum2 += sum1;
+    }
+    return sum1 ^ (uint16_t)((sum2 << 8) | (sum2 >> 8));
+}
+
 uint16_t EEPROM_Init(void) {
-    /* Load emulated eeprom contents from compacted flash into memory */
-    uint16_t *src  = (uint16_t *)FEE_COMPACTED_BASE_ADDRESS;
-    uint16_t *dest = (uint16_t *)DataBuf;
+    /* Load emulated eeprom contents from compacted flash into memory, a 32-bit word at a time where possible */
+    uint32_t *src32  = (uint32_t *)FEE_COMPACTED_BASE_ADDRESS;
+    uint32_t *dest32 = (uint32_t *)DataBuf;
+    for (; src32 < (uint32_t *)(FEE_COMPACTED_LAST_ADDRESS & ~(uintptr_t)3); ++src32, ++dest32) {
+        *dest32 = ~*src32;
+    }
+    uint16_t *src  = (uint16_t *)src32;
+    uint16_t *dest = (uint16_t *)dest32;
     for (; src < (uint16_t *)FEE_COMPACTED_LAST_ADDRESS; ++src, ++dest) {
         *dest = ~*src;
     }
@@ -258,6 +283,36 @@ uint16_t EEPROM_Init(void) {
                 address <<= 1;
                 /* Writes to addresses less than 128 are byte log entries */
                 address += FEE_BYTE_RANGE;
+            } else if ((address & FEE_VALUE_NEXT) == FEE_VALUE_BLOCK) {
+                /* Contiguous run of words, only applied if complete */
+                uint16_t *entry = log_addr;
+                if (entry + 1 >= (uint16_t *)FEE_WRITE_LOG_LAST_ADDRESS) {
+                    break;
+                }
+                uint16_t count = entry[1];
+                address        = (address & 0x1FFF) << 1;
+                if (count == FEE_EMPTY_WORD) {
+                    /* Incomplete write of the header.  Skip the count slot, so it is not reused, and continue */
+                    eeprom_printf("Incomplete block write at log_addr: 0x%04lx;\n", (uint32_t)log_addr);
+                    ++log_addr;
+                    continue;
+                }
+                if (count == 0 || entry + count + 3 > (uint16_t *)FEE_WRITE_LOG_LAST_ADDRESS) {
+                    eeprom_printf("Bad block length at log_addr: 0x%04lx;\n", (uint32_t)log_addr);
+                    continue;
+                }
+                log_addr += count + 2;
+                if (entry[count + 2] != eeprom_block_check(entry, count) || address + count * 2 > FEE_DENSITY_BYTES) {
+                    /* Possibly incomplete write.  Ignore and continue */
+                    eeprom_printf("Bad block at log_addr: 0x%04lx;\n", (uint32_t)entry);
+                    continue;
+                }
+                eeprom_printf("DataBuf[0x%04x ... 0x%04x] = block;\n", address, address + count * 2 - 1);
+                uint16_t *block_dest = (uint16_t *)(&DataBuf[address]);
+                for (uint16_t i = 0; i < count; ++i) {
+                    block_dest[i] = ~entry[i + 2];
+                }
+                continue;
             } else {
                 /* Reserved for future use */
                 if (address & FEE_VALUE_RESERVED) {
@@ -436,6 +491,93 @@ static uint8_t eeprom_write_log_byte_entry(uint16_t Address) {
     return status;
 }
 
+/* Number of log words required to write a word individually, given the value currently held */
+static uint16_t eeprom_log_word_cost(uint16_t Address, uint16_t oldValue, uint16_t newValue) {
+    if (Address < FEE_BYTE_RANGE) {
+        return ((uint8_t)oldValue != (uint8_t)newValue) + ((oldValue >> 8) != (newValue >> 8));
+    }
+    return newValue <= 1 ? 1 : 2;
+}
+
+/*
+ * Writes a run of words, which are all known to differ from DataBuf and to be unable to be written directly,
+ * as a single Word-Block log entry.
+ */
+static uint8_t eeprom_write_log_block_entry(uint16_t Address, const uint8_t *src, uint16_t count) {
+    uint16_t *dest = (uint16_t *)(&DataBuf[Address]);
+    for (uint16_t i = 0; i < count; ++i) {
+        dest[i] = src[i * 2] | (src[i * 2 + 1] << 8);
+    }
+    eeprom_printf("eeprom_write_log_block_entry(0x%04x, %d)\n", Address, count);
+
+    /* if we can't find enough empty space, we must compact emulated eeprom */
+    if (empty_slot + count + 3 > (uint16_t *)FEE_WRITE_LOG_LAST_ADDRESS) {
+        /* compact the write log into the compacted flash area */
+        return eeprom_compact();
+    }
+
+    uint16_t *   entry        = empty_slot;
+    FLASH_Status final_status = FLASH_COMPLETE;
+    FLASH_Status status;
+
+    FLASH_Unlock();
+
+    status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, FEE_WORD_ENCODING | FEE_VALUE_BLOCK | (Address >> 1));
+    if (status != FLASH_COMPLETE) final_status = status;
+    status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, count);
+    if (status != FLASH_COMPLETE) final_status = status;
+    for (uint16_t i = 0; i < count; ++i) {
+        status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, ~dest[i]);
+        if (status != FLASH_COMPLETE) final_status = status;
+    }
+    status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, eeprom_block_check(entry, count));
+    if (status != FLASH_COMPLETE) final_status = status;
+
+    FLASH_Lock();
+
+    return final_status;
+}
+
+/*
+ * Writes a word-aligned range of words, grouping contiguous runs which would otherwise require individual log entries
+ * into Word-Block log entries where that uses less of the write log.
+ */
+static uint8_t eeprom_write_words(uint16_t Address, const uint8_t *src, uint16_t count) {
+    FLASH_Status final_status = FLASH_COMPLETE;
+    FLASH_Status status;
+    uint16_t     i = 0;
+    while (i < count) {
+        /* Find the run of words which need to go to the write log, along with the cost of writing them individually */
+        uint16_t run  = 0;
+        uint16_t cost = 0;
+        while (i + run < count) {
+            uint16_t wordAddress = Address + (i + run) * 2;
+            uint16_t oldValue    = *(uint16_t *)(&DataBuf[wordAddress]);
+            uint16_t newValue    = src[(i + run) * 2] | (src[(i + run) * 2 + 1] << 8);
+            if (oldValue == newValue || *(uint16_t *)(FEE_COMPACTED_BASE_ADDRESS + wordAddress) == FEE_EMPTY_WORD) {
+                break;
+            }
+            cost += eeprom_log_word_cost(wordAddress, oldValue, newValue);
+            ++run;
+        }
+
+        if (run > 0 && run + 3 < cost) {
+            status = eeprom_write_log_block_entry(Address + i * 2, &src[i * 2], run);
+        } else {
+            /* Individual writes are at least as compact -- or the word is unchanged, or can be written directly */
+            run    = run ? run : 1;
+            status = FLASH_COMPLETE;
+            for (uint16_t j = i; j < i + run; ++j) {
+                FLASH_Status word_status = EEPROM_WriteDataWord(Address + j * 2, src[j * 2] | (src[j * 2 + 1] << 8));
+                if (word_status != 0 && word_status != FLASH_COMPLETE) status = word_status;
+            }
+        }
+        if (status != 0 && status != FLASH_COMPLETE) final_status = status;
+        i += run;
+    }
+    return final_status;
+}
+
 uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
     /* if the address is out-of-bounds, do nothing */
     if (Address >= FEE_DENSITY_BYTES) {
@@ -609,6 +751,15 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         --len;
     }
 
+    /* Write the in-bounds whole words together, so that contiguous changes can share a log entry */
+    if ((uintptr_t)dest < FEE_DENSITY_BYTES) {
+        size_t words = MIN(len / 2, (FEE_DENSITY_BYTES - (uintptr_t)dest) / 2);
+        eeprom_write_words((uintptr_t)dest, src, words);
+        dest += words * 2;
+        src += words * 2;
+        len -= words * 2;
+    }
+
     uint16_t value;
     bool     aligned = ((uintptr_t)src % 2 == 0);
     while (len > 1) {
@@ -14,6 +14,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define EEPROM_DRIVER_BACKEND
+
 #include <stdint.h>
 #include <string.h>
 
@@ -18,7 +18,11 @@
 
 #include "timer.h"
 
-static bool spiStarted = false;
+static volatile bool spiStarted = false;
+
+// State of the in-flight asynchronous transfer, if any -- spiAsyncActive is cleared from the SPI ISR
+static volatile bool spiAsyncActive = false;
+static volatile bool spiStopPending = false; // set by spi_stop_async(), cleared once spi_wait() has stopped the driver
 
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t currentSlavePin;
@@ -26,6 +30,38 @@ static pin_t currentSlavePin;
 
 static SPIConfig spiConfig;
 
+// Invoked from the SPI ISR at the end of every transfer
+static void spi_transfer_complete_cb(SPIDriver *spip) {
+    if (!spiAsyncActive) {
+        return;
+    }
+    spiAsyncActive = false;
+
+    // Release the slave for a deferred spi_stop_async() straight away. spiStop() can't be called from the ISR, so the
+    // peripheral is stopped by the next spi_wait(), which every other call goes through.
+    if (spiStopPending) {
+#if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
+        if (currentSlavePin != NO_PIN) {
+            gpio_write_pin_high(currentSlavePin);
+        }
+#endif
+        osalSysLockFromISR();
+        spiUnselectI(spip);
+        osalSysUnlockFromISR();
+    }
+}
+
+static void spi_stop_internal(void) {
+#if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
+    if (currentSlavePin != NO_PIN) {
+        gpio_write_pin_high(currentSlavePin);
+    }
+#endif
+    spiUnselect(&SPI_DRIVER);
+    spiStop(&SPI_DRIVER);
+    spiStarted = false;
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -64,6 +100,11 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    // A previous transaction may still be completing in the background
+    if (spi_wait() != SPI_STATUS_SUCCESS) {
+        return false;
+    }
+
     if (spiStarted) {
         return false;
     }
@@ -280,6 +321,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 #    error "Unsupported SPI_SELECT_MODE"
 #endif
 
+    spiConfig.end_cb = spi_transfer_complete_cb;
     spiStart(&SPI_DRIVER, &spiConfig);
     spiSelect(&SPI_DRIVER);
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
@@ -292,6 +334,11 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -299,6 +346,11 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -306,24 +358,88 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    spiAsyncActive = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_wait(void) {
+    // Give up on a transfer which never completes, rather than hanging the keyboard. It's left marked as in progress,
+    // as the driver can't safely be reused until it does complete.
+    uint16_t timeout_timer = timer_read();
+    while (spiAsyncActive) {
+        if (timer_elapsed(timeout_timer) >= (SPI_ASYNC_TIMEOUT)) {
+            return SPI_STATUS_TIMEOUT;
+        }
+    }
+
+    // Complete a deferred spi_stop_async()
+    if (spiStopPending) {
+        spiStopPending = false;
+        spi_stop_internal();
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_busy(void) {
+    return spiAsyncActive;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_receive_async(uint8_t *data, uint16_t length) {
+    spi_status_t status = spi_wait();
+    if (status != SPI_STATUS_SUCCESS) {
+        return status;
+    }
+
+    spiAsyncActive = true;
+    spiStartReceive(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop_async(void) {
+    osalSysLock();
+    if (spiAsyncActive) {
+        spiStopPending = true;
+        osalSysUnlock();
+        return;
+    }
+    osalSysUnlock();
+
+    spi_stop();
+}
+
 void spi_stop(void) {
+    if (spi_wait() != SPI_STATUS_SUCCESS) {
+        // The driver is still busy with the stalled transfer, so can't be stopped
+        return;
+    }
+
     if (spiStarted) {
-#if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
-        if (currentSlavePin != NO_PIN) {
-            gpio_write_pin_high(currentSlavePin);
-        }
-#endif
-        spiUnselect(&SPI_DRIVER);
-        spiStop(&SPI_DRIVER);
-        spiStarted = false;
+        spi_stop_internal();
     }
 }
@@ -1,11 +1,17 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include <stdbool.h>
+#include <string.h>
 #include <hal.h>
+#include "util.h"
 #include "timer.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
 
+#ifndef WEAR_LEVELING_EFL_BULK_COUNT
+#    define WEAR_LEVELING_EFL_BULK_COUNT 32
+#endif // WEAR_LEVELING_EFL_BULK_COUNT
+
 static flash_offset_t base_offset = UINT32_MAX;
 
 #if defined(WEAR_LEVELING_EFL_FIRST_SECTOR)
@@ -120,12 +126,84 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+// The final sector may extend beyond the end of the backing store, but belongs to it all the same
+static inline uint32_t erase_range_end(uint32_t address, uint32_t length) {
+    return (address + length >= (WEAR_LEVELING_BACKING_SIZE)) ? UINT32_MAX : address + length;
+}
+
+bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    uint32_t end = erase_range_end(address, length);
+    for (int i = 0; i < sector_count; ++i) {
+        // Only sectors lying entirely within the range may be erased
+        uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        uint32_t sector_end   = sector_start + flashGetSectorSize(flash, first_sector + i);
+        if (sector_end <= address || sector_start >= end) {
+            continue;
+        }
+        if (sector_start < address || sector_end > end) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    // Check the whole range up front, so that nothing is erased if any part of it can't be
+    if (!backing_store_range_erasable(address, length)) {
+        bs_dprintf("Erase range is not aligned to sector boundaries\n");
+        return false;
+    }
+
+    bool          ret = true;
+    uint32_t      end = erase_range_end(address, length);
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        uint32_t sector_start = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        if (sector_start < address || sector_start >= end) {
+            continue;
+        }
+
+        // Kick off the sector erase
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        // Wait for the erase to complete
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
-    uint32_t offset = (base_offset + address);
-    bs_dprintf("Write ");
-    wl_dump(offset, &value, sizeof(value));
-    value = ~value;
-    return flashProgram(flash, offset, sizeof(value), (const uint8_t *)&value) == FLASH_NO_ERROR;
+    return backing_store_write_bulk(address, &value, 1);
+}
+
+bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    uint32_t                   offset = (base_offset + address);
+    static backing_store_int_t temp[WEAR_LEVELING_EFL_BULK_COUNT];
+    while (item_count > 0) {
+        // Take the complement of as many values as fit, so the EFL driver can program them in a single request
+        size_t this_loop = MIN(item_count, WEAR_LEVELING_EFL_BULK_COUNT);
+        for (size_t i = 0; i < this_loop; ++i) {
+            temp[i] = ~values[i];
+        }
+
+        bs_dprintf("Write ");
+        wl_dump(offset, values, sizeof(backing_store_int_t) * this_loop);
+
+        if (flashProgram(flash, offset, sizeof(backing_store_int_t) * this_loop, (const uint8_t *)temp) != FLASH_NO_ERROR) {
+            return false;
+        }
+
+        offset += this_loop * sizeof(backing_store_int_t);
+        values += this_loop;
+        item_count -= this_loop;
+    }
+    return true;
 }
 
 bool backing_store_lock(void) {
@@ -134,31 +212,33 @@ bool backing_store_lock(void) {
     return true;
 }
 
-static backing_store_int_t backing_store_safe_read_from_location(backing_store_int_t *loc) {
-    backing_store_int_t value;
+static void backing_store_safe_read_from_location(backing_store_int_t *loc, backing_store_int_t *values, size_t item_count) {
     is_issuing_read    = true;
     ecc_error_occurred = false;
-    value              = ~(*loc);
-    is_issuing_read    = false;
-    return value;
+    for (size_t i = 0; i < item_count; ++i) {
+        values[i] = ~loc[i];
+    }
+    is_issuing_read = false;
 }
 
 bool backing_store_read(uint32_t address, backing_store_int_t *value) {
+    return backing_store_read_bulk(address, value, 1);
+}
+
+bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
     uint32_t             offset = (base_offset + address);
     backing_store_int_t *loc    = (backing_store_int_t *)flashGetOffsetAddress(flash, offset);
-    backing_store_int_t  tmp    = backing_store_safe_read_from_location(loc);
+    backing_store_safe_read_from_location(loc, values, item_count);
 
     if (ecc_error_occurred) {
         bs_dprintf("Failed to read from backing store, ECC error detected\n");
         ecc_error_occurred = false;
-        *value             = 0;
+        memset(values, 0, sizeof(backing_store_int_t) * item_count);
         return false;
     }
 
-    *value = tmp;
-
     bs_dprintf("Read  ");
-    wl_dump(offset, value, sizeof(backing_store_int_t));
+    wl_dump(offset, values, sizeof(backing_store_int_t) * item_count);
     return true;
 }
 
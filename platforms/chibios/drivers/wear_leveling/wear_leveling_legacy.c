@@ -36,6 +36,25 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    return address % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) == 0 && length % (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE) == 0;
+}
+
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    if (!backing_store_range_erasable(address, length)) {
+        bs_dprintf("Erase range is not aligned to page boundaries\n");
+        return false;
+    }
+
+    bool ret = true;
+    for (uint32_t i = 0; i < length; i += (WEAR_LEVELING_LEGACY_EMULATION_PAGE_SIZE)) {
+        if (FLASH_ErasePage(WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS + address + i) != FLASH_COMPLETE) {
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = ((WEAR_LEVELING_LEGACY_EMULATION_BASE_PAGE_ADDRESS) + address);
     bs_dprintf("Write ");
@@ -18,9 +18,12 @@
 #include "wear_leveling_internal.h"
 
 #ifndef WEAR_LEVELING_RP2040_FLASH_BULK_COUNT
-#    define WEAR_LEVELING_RP2040_FLASH_BULK_COUNT 64
+#    define WEAR_LEVELING_RP2040_FLASH_BULK_COUNT ((FLASH_PAGE_SIZE) / sizeof(backing_store_int_t))
 #endif // WEAR_LEVELING_RP2040_FLASH_BULK_COUNT
 
+// A page program wraps around within the page, so batches must never cross a page boundary
+_Static_assert((WEAR_LEVELING_RP2040_FLASH_BULK_COUNT) * sizeof(backing_store_int_t) <= (FLASH_PAGE_SIZE), "WEAR_LEVELING_RP2040_FLASH_BULK_COUNT must fit within FLASH_PAGE_SIZE");
+
 #define FLASHCMD_PAGE_PROGRAM 0x02
 #define FLASHCMD_READ_STATUS 0x05
 #define FLASHCMD_WRITE_ENABLE 0x06
@@ -133,25 +136,28 @@ static void __no_inline_not_in_flash_func(pico_program_bulk)(uint32_t flash_addr
 
     static backing_store_int_t bulk_write_buffer[WEAR_LEVELING_RP2040_FLASH_BULK_COUNT];
 
+    // Leave XIP once for the whole request -- everything until it's re-enabled executes from, and reads from, RAM
+    connect_internal_flash();
+    flash_exit_xip();
+
     while (item_count) {
-        size_t batch_size = MIN(item_count, WEAR_LEVELING_RP2040_FLASH_BULK_COUNT);
+        // Limit each batch to the remainder of the current page
+        size_t page_remaining = ((FLASH_PAGE_SIZE) - (flash_address % (FLASH_PAGE_SIZE))) / sizeof(backing_store_int_t);
+        size_t batch_size     = MIN(MIN(item_count, WEAR_LEVELING_RP2040_FLASH_BULK_COUNT), page_remaining);
         for (size_t i = 0; i < batch_size; i++, values++, item_count--) {
             bulk_write_buffer[i] = ~(*values);
         }
         __compiler_memory_barrier();
 
-        connect_internal_flash();
-        flash_exit_xip();
         flash_enable_write();
-
         flash_put_cmd_addr(FLASHCMD_PAGE_PROGRAM, flash_address);
         flash_put_get((uint8_t *)bulk_write_buffer, NULL, batch_size * sizeof(backing_store_int_t), 4);
         flash_wait_ready();
         flash_address += batch_size * sizeof(backing_store_int_t);
-
-        flash_flush_cache();
-        flash_enable_xip_via_boot2();
     }
+
+    flash_flush_cache();
+    flash_enable_xip_via_boot2();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +193,22 @@ bool backing_store_erase(void) {
     return true;
 }
 
+bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    return address % (FLASH_SECTOR_SIZE) == 0 && length % (FLASH_SECTOR_SIZE) == 0;
+}
+
+bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    if (!backing_store_range_erasable(address, length)) {
+        bs_dprintf("Erase range is not aligned to sector boundaries\n");
+        return false;
+    }
+
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, length);
+    restore_interrupts(interrupts);
+    return true;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
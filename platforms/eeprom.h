@@ -8,6 +8,12 @@
 #    include <stdint.h>
 #    include <stdlib.h>
 
+#    if defined(EEPROM_DRIVER) && defined(EEPROM_ASYNC_ENABLE) && !defined(EEPROM_DRIVER_BACKEND)
+// Route block accesses through the asynchronous write queue, rather than directly to the driver
+#        define eeprom_read_block eeprom_async_read_block
+#        define eeprom_write_block eeprom_async_write_block
+#    endif
+
 uint8_t  eeprom_read_byte(const uint8_t *__p);
 uint16_t eeprom_read_word(const uint16_t *__p);
 uint32_t eeprom_read_dword(const uint32_t *__p);
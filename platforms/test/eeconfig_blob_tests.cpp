@@ -0,0 +1,125 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom_driver.h"
+#include "action_layer.h"
+
+layer_state_t default_layer_state;
+
+void eeconfig_core_invalidate(void);
+}
+
+typedef std::array<uint8_t, sizeof(eeprom_core_t)> raw_core_t;
+
+// Contents of the EEPROM backing the core configuration, as seen by eeconfig_init_kb() during eeconfig_init_quantum()
+static raw_core_t raw_during_init;
+
+extern "C" void eeconfig_init_kb(void) {
+    eeprom_read_block(raw_during_init.data(), EECONFIG_MAGIC, raw_during_init.size());
+}
+
+class EeconfigBlob : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_driver_init();
+        eeconfig_core_invalidate();
+        eeconfig_init_quantum();
+    }
+
+    // Reads the EEPROM directly, bypassing the cache
+    raw_core_t read_raw() {
+        raw_core_t raw;
+        eeprom_read_block(raw.data(), EECONFIG_MAGIC, raw.size());
+        return raw;
+    }
+
+    // Writes the EEPROM directly, bypassing the cache
+    void write_raw_byte(const uint8_t *addr, uint8_t value) {
+        eeprom_write_block(&value, (void *)addr, sizeof(value));
+    }
+};
+
+/**
+ * This test verifies that settings written through the cache are reloaded intact.
+ */
+TEST_F(EeconfigBlob, ReloadAfterUpdate) {
+    eeconfig_update_byte(EECONFIG_DEBUG, 0x5A);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, 0x12345678);
+
+    eeconfig_core_invalidate();
+    EXPECT_TRUE(eeconfig_is_enabled()) << "Valid blob was rejected on reload";
+    EXPECT_EQ(eeconfig_read_byte(EECONFIG_DEBUG), 0x5A) << "Incorrect value after reload";
+    EXPECT_EQ(eeconfig_read_dword(EECONFIG_RGBLIGHT), 0x12345678u) << "Incorrect value after reload";
+}
+
+/**
+ * This test verifies that eeconfig_init_quantum() defers all of its writes until the end of the batch.
+ */
+TEST_F(EeconfigBlob, InitIsBatched) {
+    raw_core_t erased{};
+    EXPECT_EQ(raw_during_init, erased) << "EEPROM was written before the end of the batch";
+
+    eeconfig_core_invalidate();
+    EXPECT_TRUE(eeconfig_is_enabled()) << "Batched init did not produce a valid blob";
+    EXPECT_EQ(eeconfig_read_word(EECONFIG_KEYMAP), 0x1400) << "Incorrect value after reload";
+}
+
+/**
+ * This test verifies that an update only writes the changed bytes and the version/CRC trailer.
+ */
+TEST_F(EeconfigBlob, UpdateWritesOnlyDirtySpan) {
+    // Make the EEPROM differ from the cache outside of the span being updated, so any rewrite of it is detectable
+    write_raw_byte(EECONFIG_AUDIO, 0xA5);
+    write_raw_byte((uint8_t *)EECONFIG_HAPTIC, 0xA5);
+
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, 0x03);
+
+    raw_core_t raw = read_raw();
+    EXPECT_EQ(raw[(uintptr_t)EECONFIG_UNICODEMODE], 0x03) << "Changed byte was not written";
+    EXPECT_EQ(raw[(uintptr_t)EECONFIG_AUDIO], 0xA5) << "Unchanged byte before the dirty span was rewritten";
+    EXPECT_EQ(raw[(uintptr_t)EECONFIG_HAPTIC], 0xA5) << "Unchanged byte after the dirty span was rewritten";
+    EXPECT_EQ(raw[(uintptr_t)EECONFIG_BLOB_VERSION_OFFSET], EECONFIG_BLOB_VERSION) << "Version was not written";
+
+    // Rewriting the same value is a no-op
+    write_raw_byte(EECONFIG_UNICODEMODE, 0x00);
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, 0x03);
+    EXPECT_EQ(read_raw()[(uintptr_t)EECONFIG_UNICODEMODE], 0x00) << "Unchanged value was written";
+}
+
+/**
+ * This test verifies that a CRC mismatch forces a re-init, while retaining handedness.
+ */
+TEST_F(EeconfigBlob, CrcMismatchRetainsHandedness) {
+    eeconfig_update_handedness(true);
+    eeconfig_update_byte(EECONFIG_DEBUG, 0x5A);
+
+    // Change a byte underneath the cache, as if it were corrupted
+    write_raw_byte(EECONFIG_DEBUG, 0x5B);
+
+    eeconfig_core_invalidate();
+    EXPECT_FALSE(eeconfig_is_enabled()) << "Corrupted blob was accepted";
+    EXPECT_EQ(eeconfig_read_byte(EECONFIG_DEBUG), 0) << "Corrupted contents were not cleared";
+    EXPECT_TRUE(eeconfig_read_handedness()) << "Handedness was not retained";
+
+    // The next write stores the whole blob, as none of the EEPROM contents are known to be good
+    eeconfig_update_byte(EECONFIG_AUDIO, 0x01);
+    EXPECT_EQ(read_raw()[(uintptr_t)EECONFIG_DEBUG], 0) << "Corrupted byte was not rewritten";
+
+    eeconfig_core_invalidate();
+    EXPECT_EQ(eeconfig_read_byte(EECONFIG_AUDIO), 0x01) << "Blob was not valid after rewrite";
+    EXPECT_TRUE(eeconfig_read_handedness()) << "Handedness was not retained after rewrite";
+}
+
+/**
+ * This test verifies that a version mismatch forces a re-init.
+ */
+TEST_F(EeconfigBlob, VersionMismatch) {
+    write_raw_byte(EECONFIG_BLOB_VERSION_OFFSET, (EECONFIG_BLOB_VERSION) + 1);
+
+    eeconfig_core_invalidate();
+    EXPECT_FALSE(eeconfig_is_enabled()) << "Blob with the wrong version was accepted";
+}
@@ -0,0 +1,164 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include "gtest/gtest.h"
+
+// Access the transient backend directly, rather than through the queue
+#define EEPROM_DRIVER_BACKEND
+
+extern "C" {
+#include "eeprom_driver.h"
+
+void eeprom_async_read_block(void *buf, const void *addr, size_t len);
+void eeprom_async_write_block(const void *buf, void *addr, size_t len);
+void eeprom_async_erase(void);
+}
+
+// Each entry takes a 6 byte header, so the queue holds a single 26 byte entry or four 1 byte entries
+static_assert(EEPROM_ASYNC_QUEUE_SIZE == 32, "Tests expect a 32 byte queue");
+static_assert(EEPROM_ASYNC_WRITE_CHUNK == 8, "Tests expect 8 byte chunks");
+
+typedef std::array<uint8_t, 64> block_t;
+
+class EepromAsync : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_driver_init();
+        eeprom_async_erase();
+    }
+
+    void write_byte(uintptr_t addr, uint8_t value) {
+        eeprom_async_write_block(&value, (void *)addr, sizeof(value));
+    }
+
+    // Reads through the queue, as seen by everything outside of the driver layer
+    uint8_t read_byte(uintptr_t addr) {
+        uint8_t value;
+        eeprom_async_read_block(&value, (const void *)addr, sizeof(value));
+        return value;
+    }
+
+    // Reads the backend, as written so far
+    uint8_t backend_byte(uintptr_t addr) {
+        uint8_t value;
+        eeprom_read_block(&value, (const void *)addr, sizeof(value));
+        return value;
+    }
+};
+
+/**
+ * This test verifies that sequential writes are merged into a single entry, rather than filling the queue.
+ */
+TEST_F(EepromAsync, SequentialWritesCoalesce) {
+    for (uint8_t i = 0; i < 20; ++i) {
+        write_byte(i, i + 1);
+    }
+
+    // Unmerged, these would need 140 bytes of queue, forcing the oldest to be written out
+    for (uint8_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(backend_byte(i), 0) << "Byte " << (int)i << " was written before the queue was drained";
+        EXPECT_EQ(read_byte(i), i + 1) << "Byte " << (int)i << " was not overlaid from the queue";
+    }
+
+    eeprom_driver_flush();
+    for (uint8_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(backend_byte(i), i + 1) << "Byte " << (int)i << " was not written by the flush";
+    }
+}
+
+/**
+ * This test verifies that rewriting data still in the newest entry replaces it in place.
+ */
+TEST_F(EepromAsync, OverwriteCoalesces) {
+    uint8_t data[4] = {1, 2, 3, 4};
+    eeprom_async_write_block(data, (void *)10, sizeof(data));
+    write_byte(11, 0x22);
+    write_byte(12, 0x33);
+    EXPECT_EQ(read_byte(11), 0x22);
+
+    // A further 16 byte entry only fits if the overwrites were merged
+    block_t more;
+    more.fill(0xAA);
+    eeprom_async_write_block(more.data(), (void *)40, 16);
+    EXPECT_EQ(backend_byte(10), 0) << "Oldest entry was written out, overwrites were not merged";
+
+    eeprom_driver_flush();
+    EXPECT_EQ(backend_byte(10), 1);
+    EXPECT_EQ(backend_byte(11), 0x22);
+    EXPECT_EQ(backend_byte(12), 0x33);
+    EXPECT_EQ(backend_byte(13), 4);
+    EXPECT_EQ(backend_byte(55), 0xAA);
+}
+
+/**
+ * This test verifies that each task pass writes at most one chunk, and that reads stay consistent while partially
+ * drained.
+ */
+TEST_F(EepromAsync, PartialDrain) {
+    block_t data;
+    for (size_t i = 0; i < 20; ++i) {
+        data[i] = i + 1;
+    }
+    eeprom_async_write_block(data.data(), (void *)0, 20);
+
+    eeprom_driver_task();
+    for (uint8_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(backend_byte(i), i < EEPROM_ASYNC_WRITE_CHUNK ? i + 1 : 0) << "Byte " << (int)i << " was not drained in order";
+        EXPECT_EQ(read_byte(i), i + 1) << "Byte " << (int)i << " read incorrectly while partially drained";
+    }
+
+    // Writes appended to the partially drained entry are still merged
+    write_byte(20, 21);
+    eeprom_driver_task();
+    eeprom_driver_task();
+    for (uint8_t i = 0; i <= 20; ++i) {
+        EXPECT_EQ(backend_byte(i), i + 1) << "Byte " << (int)i << " was not drained";
+    }
+}
+
+/**
+ * This test verifies that newer queued writes take precedence over older ones, both when read and once written.
+ */
+TEST_F(EepromAsync, ReadOverlayOrder) {
+    write_byte(5, 0x11);
+    write_byte(30, 0x22);
+    write_byte(5, 0x33); // not adjacent to the newest entry, so queued separately
+    EXPECT_EQ(read_byte(5), 0x33) << "Older queued write took precedence";
+
+    uint8_t block[4];
+    eeprom_async_read_block(block, (const void *)4, sizeof(block));
+    EXPECT_EQ(block[0], 0);
+    EXPECT_EQ(block[1], 0x33);
+
+    eeprom_driver_flush();
+    EXPECT_EQ(backend_byte(5), 0x33) << "Queued writes were drained out of order";
+    EXPECT_EQ(backend_byte(30), 0x22);
+}
+
+/**
+ * This test verifies that a full queue writes out its oldest entry to make room.
+ */
+TEST_F(EepromAsync, FullQueueWritesOldest) {
+    for (uint8_t i = 0; i < 4; ++i) {
+        write_byte(i * 10, i + 1);
+    }
+    EXPECT_EQ(backend_byte(0), 0);
+
+    write_byte(40, 5);
+    EXPECT_EQ(backend_byte(0), 1) << "Oldest entry was not written out to make room";
+    EXPECT_EQ(backend_byte(10), 0) << "More than the oldest entry was written out";
+    for (uint8_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(read_byte(i * 10), i + 1);
+    }
+}
+
+/**
+ * This test verifies that erasing discards queued writes.
+ */
+TEST_F(EepromAsync, EraseDiscardsQueue) {
+    write_byte(0, 0x55);
+    eeprom_async_erase();
+    EXPECT_EQ(read_byte(0), 0);
+    eeprom_driver_flush();
+    EXPECT_EQ(backend_byte(0), 0);
+}
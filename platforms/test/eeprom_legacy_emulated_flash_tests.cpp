@@ -53,6 +53,7 @@ extern "C" {
 #define WORD_ZERO(addr) (0x8000 | ((addr) >> 1))
 #define WORD_ONE(addr) (0xA000 | ((addr) >> 1))
 #define WORD_NEXT(addr) (0xE000 | (((addr)-0x80) >> 1))
+#define WORD_BLOCK(addr) (0xC000 | ((addr) >> 1))
 
 class EepromStm32Test : public testing::Test {
    public:
@@ -435,3 +436,95 @@ TEST_F(EepromStm32Test, TestCompaction) {
     EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
     EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + LOG_SIZE - 2], 0xFFFF);
 }
+
+TEST_F(EepromStm32Test, TestWordBlockEntry) {
+    uint16_t first[8]  = {0x1234, 0x5678, 0x9abc, 0xdef0, 0x0f1e, 0x2d3c, 0x4b5a, 0x6978};
+    uint16_t second[8] = {0x4321, 0x8765, 0xcba9, 0x0fed, 0xe1f0, 0xc3d2, 0xa5b4, 0x8796};
+    uint16_t readBuf[8];
+    /* First write goes directly to the compacted area */
+    eeprom_write_block(first, (void*)0x90, sizeof(first));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
+    /* Second write is logged as a single block entry */
+    eeprom_write_block(second, (void*)0x90, sizeof(second));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], WORD_BLOCK(0x90));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 2], 8);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 4], (uint16_t)~second[0]);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 18], (uint16_t)~second[7]);
+    EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE + 20], 0xFFFF);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 22], 0xFFFF);
+    /* Check values after playback */
+    EEPROM_Init();
+    eeprom_read_block(readBuf, (void*)0x90, sizeof(readBuf));
+    EXPECT_EQ(memcmp(readBuf, second, sizeof(second)), 0);
+    /* Writes following the block are played back as usual */
+    eeprom_write_word((uint16_t*)0x92, 0);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 22], WORD_ZERO(0x92));
+    EEPROM_Init();
+    EXPECT_EQ(eeprom_read_word((uint16_t*)0x90), 0x4321);
+    EXPECT_EQ(eeprom_read_word((uint16_t*)0x92), 0);
+    EXPECT_EQ(eeprom_read_word((uint16_t*)0x94), 0xcba9);
+}
+
+TEST_F(EepromStm32Test, TestWordBlockTorn) {
+    uint16_t first[8]  = {0x1234, 0x5678, 0x9abc, 0xdef0, 0x0f1e, 0x2d3c, 0x4b5a, 0x6978};
+    uint16_t second[8] = {0x4321, 0x8765, 0xcba9, 0x0fed, 0xe1f0, 0xc3d2, 0xa5b4, 0x8796};
+    uint16_t readBuf[8];
+    eeprom_write_block(first, (void*)0x90, sizeof(first));
+    eeprom_write_block(second, (void*)0x90, sizeof(second));
+    eeprom_write_word((uint16_t*)0xA0, 1);
+    /* Simulate an incomplete write of the block, by erasing its check value */
+    *(uint16_t*)&FlashBuf[LOG_BASE + 20] = 0xFFFF;
+    EEPROM_Init();
+    eeprom_read_block(readBuf, (void*)0x90, sizeof(readBuf));
+    EXPECT_EQ(memcmp(readBuf, first, sizeof(first)), 0);
+    /* Entries after the block are still played back */
+    EXPECT_EQ(eeprom_read_word((uint16_t*)0xA0), 1);
+}
+
+TEST_F(EepromStm32Test, TestWordBlockTornHeader) {
+    uint16_t first[8]  = {0x1234, 0x5678, 0x9abc, 0xdef0, 0x0f1e, 0x2d3c, 0x4b5a, 0x6978};
+    uint16_t second[8] = {0x4321, 0x8765, 0xcba9, 0x0fed, 0xe1f0, 0xc3d2, 0xa5b4, 0x8796};
+    uint16_t readBuf[8];
+    eeprom_write_byte((uint8_t*)0, 1);
+    eeprom_write_block(first, (void*)0x90, sizeof(first));
+    eeprom_write_block(second, (void*)0x90, sizeof(second));
+    /* Simulate an incomplete write of the block header, by erasing everything after it */
+    for (uint32_t i = 2; i < 22; i += 2) {
+        *(uint16_t*)&FlashBuf[LOG_BASE + i] = 0xFFFF;
+    }
+    EEPROM_Init();
+    /* The next entry must not be written into the count slot, where it would be read back as a count */
+    eeprom_write_byte((uint8_t*)0, 2);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 2], 0xFFFF);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 4], BYTE_VALUE(0, 2));
+    EEPROM_Init();
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)0), 2);
+    eeprom_read_block(readBuf, (void*)0x90, sizeof(readBuf));
+    EXPECT_EQ(memcmp(readBuf, first, sizeof(first)), 0);
+}
+
+TEST_F(EepromStm32Test, TestWordBlockCompaction) {
+    uint16_t value[8] = {0x1234, 0x5678, 0x9abc, 0xdef0, 0x0f1e, 0x2d3c, 0x4b5a, 0x6978};
+    uint16_t readBuf[8];
+    eeprom_write_block(value, (void*)0x90, sizeof(value));
+    /* Fill the write log with block entries */
+    for (uint32_t i = 0; i < LOG_SIZE / 22; i++) {
+        for (uint32_t j = 0; j < 8; j++) {
+            value[j] += 0x0101;
+        }
+        eeprom_write_block(value, (void*)0x90, sizeof(value));
+    }
+    EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE + (LOG_SIZE / 22 - 1) * 22], 0xFFFF);
+    EEPROM_Init();
+    eeprom_read_block(readBuf, (void*)0x90, sizeof(readBuf));
+    EXPECT_EQ(memcmp(readBuf, value, sizeof(value)), 0);
+    /* Run compaction */
+    for (uint32_t j = 0; j < 8; j++) {
+        value[j] += 0x0101;
+    }
+    eeprom_write_block(value, (void*)0x90, sizeof(value));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
+    EEPROM_Init();
+    eeprom_read_block(readBuf, (void*)0x90, sizeof(readBuf));
+    EXPECT_EQ(memcmp(readBuf, value, sizeof(value)), 0);
+}
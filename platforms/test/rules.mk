@@ -23,3 +23,23 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeconfig_blob_DEFS := -DEEPROM_TEST_HARNESS -DEEPROM_DRIVER -DEEPROM_TRANSIENT -DEECONFIG_BLOB_ENABLE -DNO_PRINT
+eeconfig_blob_INC := \
+	$(TOP_DIR)/drivers/eeprom/
+eeconfig_blob_SRC := \
+	$(QUANTUM_PATH)/eeconfig.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_transient.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeconfig_blob_tests.cpp
+
+eeprom_async_DEFS := -DEEPROM_TEST_HARNESS -DEEPROM_DRIVER -DEEPROM_TRANSIENT -DEEPROM_ASYNC_ENABLE -DNO_PRINT \
+	-DEEPROM_ASYNC_QUEUE_SIZE=32 \
+	-DEEPROM_ASYNC_WRITE_CHUNK=8 \
+	-DTRANSIENT_EEPROM_SIZE=64
+eeprom_async_INC := \
+	$(TOP_DIR)/drivers/eeprom/
+eeprom_async_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_transient.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_async_tests.cpp
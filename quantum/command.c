@@ -38,6 +38,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "backlight.h"
 #endif
 
+#if defined(EEPROM_STATS_ENABLE) && defined(EEPROM_DRIVER)
+#    include "eeprom_driver.h"
+#endif
+
 #if defined(MOUSEKEY_ENABLE)
 #    include "mousekey.h"
 #endif
@@ -333,6 +337,9 @@ static bool command_common(uint8_t code) {
         case MAGIC_KC(MAGIC_KEY_EEPROM):
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
             print_eeconfig();
+#    if defined(EEPROM_STATS_ENABLE) && defined(EEPROM_DRIVER)
+            eeprom_driver_print_stats();
+#    endif
 #endif /* !NO_PRINT && !USER_PRINT */
             break;
 
@@ -21,6 +21,182 @@ void eeconfig_init_via(void);
 
 _Static_assert((intptr_t)EECONFIG_HANDEDNESS == 14, "EEPROM handedness offset is incorrect");
 
+#if defined(EECONFIG_BLOB_ENABLE)
+static eeprom_core_t eeconfig_core;
+static bool          eeconfig_core_loaded = false;
+static uint8_t       eeconfig_core_batch  = 0;
+
+// Range of the cache that differs from the EEPROM, as [start, end) -- empty when start >= end
+static uint8_t eeconfig_core_dirty_start = sizeof(eeprom_core_t);
+static uint8_t eeconfig_core_dirty_end   = 0;
+
+static void eeconfig_core_mark_dirty(size_t offset, size_t len) {
+    eeconfig_core_dirty_start = MIN(eeconfig_core_dirty_start, offset);
+    eeconfig_core_dirty_end   = MAX(eeconfig_core_dirty_end, offset + len);
+}
+
+/** \brief CRC-16/CCITT of the core configuration, excluding the CRC itself
+ */
+static uint16_t eeconfig_core_crc(void) {
+    const uint8_t *data = (const uint8_t *)&eeconfig_core;
+    uint16_t       crc  = 0xFFFF;
+    for (size_t i = 0; i < offsetof(eeprom_core_t, blob_crc); ++i) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/** \brief Loads the core configuration with a single read, on first access
+ *
+ * If the version or CRC don't match, the contents can't be trusted; the cache is cleared so that the magic number no
+ * longer matches, forcing a re-init. Handedness is kept as-is, as it may have been flashed on its own. As none of the
+ * EEPROM contents can be relied upon, the whole cache is written back on the next flush.
+ */
+static void eeconfig_core_load(void) {
+    if (eeconfig_core_loaded) {
+        return;
+    }
+    eeprom_read_block(&eeconfig_core, EECONFIG_MAGIC, sizeof(eeconfig_core));
+    eeconfig_core_loaded = true;
+    if (eeconfig_core.blob_version != (EECONFIG_BLOB_VERSION) || eeconfig_core.blob_crc != eeconfig_core_crc()) {
+        uint8_t handedness = eeconfig_core.handedness;
+        memset(&eeconfig_core, 0, sizeof(eeconfig_core));
+        eeconfig_core.handedness = handedness;
+        eeconfig_core_mark_dirty(0, sizeof(eeconfig_core));
+    }
+}
+
+/** \brief Writes the changed part of the core configuration along with the version and CRC, unless batching updates
+ *
+ * Only the dirty span is written rather than the whole blob, so that changing a single setting costs no more EEPROM
+ * writes than it did without the cache.
+ */
+static void eeconfig_core_flush(void) {
+    if (eeconfig_core_batch > 0 || eeconfig_core_dirty_start >= eeconfig_core_dirty_end) {
+        return;
+    }
+    eeconfig_core.blob_version = (EECONFIG_BLOB_VERSION);
+    eeconfig_core.blob_crc     = eeconfig_core_crc();
+
+    const uint8_t *data    = (const uint8_t *)&eeconfig_core;
+    size_t         start   = eeconfig_core_dirty_start;
+    const size_t   trailer = offsetof(eeprom_core_t, blob_version);
+    if (eeconfig_core_dirty_end < trailer) {
+        eeprom_update_block(data + start, (void *)start, eeconfig_core_dirty_end - start);
+        start = trailer;
+    }
+    eeprom_update_block(data + start, (void *)start, sizeof(eeconfig_core) - start);
+
+    eeconfig_core_dirty_start = sizeof(eeprom_core_t);
+    eeconfig_core_dirty_end   = 0;
+}
+
+/** \brief Matches the cache to the EEPROM contents after an erase
+ */
+static void eeconfig_core_reset(void) {
+    memset(&eeconfig_core, 0, sizeof(eeconfig_core));
+    eeconfig_core_loaded      = true;
+    eeconfig_core_dirty_start = sizeof(eeprom_core_t);
+    eeconfig_core_dirty_end   = 0;
+}
+
+#    if defined(EEPROM_TEST_HARNESS)
+/** \brief Drops the cache, so that the next access reloads it from the EEPROM
+ */
+void eeconfig_core_invalidate(void) {
+    eeconfig_core_loaded      = false;
+    eeconfig_core_batch       = 0;
+    eeconfig_core_dirty_start = sizeof(eeprom_core_t);
+    eeconfig_core_dirty_end   = 0;
+}
+#    endif
+
+static void eeconfig_core_batch_begin(void) {
+    eeconfig_core_load();
+    ++eeconfig_core_batch;
+}
+
+static void eeconfig_core_batch_end(void) {
+    if (--eeconfig_core_batch == 0) {
+        eeconfig_core_flush();
+    }
+}
+
+void eeconfig_read_block(void *buf, const void *addr, size_t len) {
+    uintptr_t offset = (uintptr_t)addr;
+    uint8_t * dest   = (uint8_t *)buf;
+    if (offset < sizeof(eeprom_core_t)) {
+        size_t count = MIN(len, sizeof(eeprom_core_t) - offset);
+        eeconfig_core_load();
+        memcpy(dest, (const uint8_t *)&eeconfig_core + offset, count);
+        dest += count;
+        offset += count;
+        len -= count;
+    }
+    if (len > 0) {
+        eeprom_read_block(dest, (const void *)offset, len);
+    }
+}
+
+void eeconfig_update_block(const void *buf, void *addr, size_t len) {
+    uintptr_t      offset = (uintptr_t)addr;
+    const uint8_t *src    = (const uint8_t *)buf;
+    if (offset < sizeof(eeprom_core_t)) {
+        size_t   count = MIN(len, sizeof(eeprom_core_t) - offset);
+        uint8_t *dest  = (uint8_t *)&eeconfig_core + offset;
+        eeconfig_core_load();
+        if (memcmp(dest, src, count) != 0) {
+            memcpy(dest, src, count);
+            eeconfig_core_mark_dirty(offset, count);
+            eeconfig_core_flush();
+        }
+        src += count;
+        offset += count;
+        len -= count;
+    }
+    if (len > 0) {
+        eeprom_update_block(src, (void *)offset, len);
+    }
+}
+
+uint8_t eeconfig_read_byte(const uint8_t *addr) {
+    uint8_t value;
+    eeconfig_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+uint16_t eeconfig_read_word(const uint16_t *addr) {
+    uint16_t value;
+    eeconfig_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+uint32_t eeconfig_read_dword(const uint32_t *addr) {
+    uint32_t value;
+    eeconfig_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+void eeconfig_update_byte(uint8_t *addr, uint8_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+
+void eeconfig_update_word(uint16_t *addr, uint16_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+
+void eeconfig_update_dword(uint32_t *addr, uint32_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+#else
+#    define eeconfig_core_reset()
+#    define eeconfig_core_batch_begin()
+#    define eeconfig_core_batch_end()
+#endif
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -47,22 +223,27 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+    eeconfig_core_reset();
 #endif
 
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
-    eeprom_update_byte(EECONFIG_DEBUG, 0);
+    // Collect all core updates into a single flush, when the core configuration is cached
+    eeconfig_core_batch_begin();
+
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_byte(EECONFIG_DEBUG, 0);
     default_layer_state = (layer_state_t)1 << 0;
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, default_layer_state);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, default_layer_state);
     // Enable oneshot and autocorrect by default: 0b0001 0100 0000 0000
-    eeprom_update_word(EECONFIG_KEYMAP, 0x1400);
-    eeprom_update_byte(EECONFIG_BACKLIGHT, 0);
-    eeprom_update_byte(EECONFIG_AUDIO, 0);
-    eeprom_update_dword(EECONFIG_RGBLIGHT, 0);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
-    eeprom_update_byte(EECONFIG_UNICODEMODE, 0);
-    eeprom_update_byte(EECONFIG_STENOMODE, 0);
-    eeprom_write_qword(EECONFIG_RGB_MATRIX, 0);
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
+    eeconfig_update_word(EECONFIG_KEYMAP, 0x1400);
+    eeconfig_update_byte(EECONFIG_BACKLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_AUDIO, 0);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, 0);
+    eeconfig_update_byte(EECONFIG_STENOMODE, 0);
+    uint64_t dummy = 0;
+    eeconfig_update_block(&dummy, EECONFIG_RGB_MATRIX, sizeof(uint64_t));
+    eeconfig_update_dword(EECONFIG_HAPTIC, 0);
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
 #endif
@@ -84,6 +265,8 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+
+    eeconfig_core_batch_end();
 }
 
 /** \brief eeconfig initialization
@@ -99,7 +282,7 @@ void eeconfig_init(void) {
  * FIXME: needs doc
  */
 void eeconfig_enable(void) {
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
 }
 
 /** \brief eeconfig disable
@@ -109,8 +292,9 @@ void eeconfig_enable(void) {
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+    eeconfig_core_reset();
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
 
 /** \brief eeconfig is enabled
@@ -118,7 +302,7 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
-    bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+    bool is_eeprom_enabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -132,7 +316,7 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
-    bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+    bool is_eeprom_disabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -146,14 +330,14 @@ bool eeconfig_is_disabled(void) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_debug(void) {
-    return eeprom_read_byte(EECONFIG_DEBUG);
+    return eeconfig_read_byte(EECONFIG_DEBUG);
 }
 /** \brief eeconfig update debug
  *
  * FIXME: needs doc
  */
 void eeconfig_update_debug(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEBUG, val);
+    eeconfig_update_byte(EECONFIG_DEBUG, val);
 }
 
 /** \brief eeconfig read default layer
@@ -161,14 +345,14 @@ void eeconfig_update_debug(uint8_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_default_layer(void) {
-    return eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
+    return eeconfig_read_byte(EECONFIG_DEFAULT_LAYER);
 }
 /** \brief eeconfig update default layer
  *
  * FIXME: needs doc
  */
 void eeconfig_update_default_layer(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, val);
 }
 
 /** \brief eeconfig read keymap
@@ -176,14 +360,14 @@ void eeconfig_update_default_layer(uint8_t val) {
  * FIXME: needs doc
  */
 uint16_t eeconfig_read_keymap(void) {
-    return eeprom_read_word(EECONFIG_KEYMAP);
+    return eeconfig_read_word(EECONFIG_KEYMAP);
 }
 /** \brief eeconfig update keymap
  *
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
-    eeprom_update_word(EECONFIG_KEYMAP, val);
+    eeconfig_update_word(EECONFIG_KEYMAP, val);
 }
 
 /** \brief eeconfig read audio
@@ -191,14 +375,14 @@ void eeconfig_update_keymap(uint16_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_audio(void) {
-    return eeprom_read_byte(EECONFIG_AUDIO);
+    return eeconfig_read_byte(EECONFIG_AUDIO);
 }
 /** \brief eeconfig update audio
  *
  * FIXME: needs doc
  */
 void eeconfig_update_audio(uint8_t val) {
-    eeprom_update_byte(EECONFIG_AUDIO, val);
+    eeconfig_update_byte(EECONFIG_AUDIO, val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) == 0
@@ -207,14 +391,14 @@ void eeconfig_update_audio(uint8_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_kb(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD);
 }
 /** \brief eeconfig update kb
  *
  * FIXME: needs doc
  */
 void eeconfig_update_kb(uint32_t val) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, val);
+    eeconfig_update_dword(EECONFIG_KEYBOARD, val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
 
@@ -224,14 +408,14 @@ void eeconfig_update_kb(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_user(void) {
-    return eeprom_read_dword(EECONFIG_USER);
+    return eeconfig_read_dword(EECONFIG_USER);
 }
 /** \brief eeconfig update user
  *
  * FIXME: needs doc
  */
 void eeconfig_update_user(uint32_t val) {
-    eeprom_update_dword(EECONFIG_USER, val);
+    eeconfig_update_dword(EECONFIG_USER, val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
 
@@ -240,14 +424,14 @@ void eeconfig_update_user(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_haptic(void) {
-    return eeprom_read_dword(EECONFIG_HAPTIC);
+    return eeconfig_read_dword(EECONFIG_HAPTIC);
 }
 /** \brief eeconfig update haptic
  *
  * FIXME: needs doc
  */
 void eeconfig_update_haptic(uint32_t val) {
-    eeprom_update_dword(EECONFIG_HAPTIC, val);
+    eeconfig_update_dword(EECONFIG_HAPTIC, val);
 }
 
 /** \brief eeconfig read split handedness
@@ -255,14 +439,14 @@ void eeconfig_update_haptic(uint32_t val) {
  * FIXME: needs doc
  */
 bool eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+    return !!eeconfig_read_byte(EECONFIG_HANDEDNESS);
 }
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
 void eeconfig_update_handedness(bool val) {
-    eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, !!val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
@@ -271,7 +455,7 @@ void eeconfig_update_handedness(bool val) {
  * FIXME: needs doc
  */
 bool eeconfig_is_kb_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
 }
 /** \brief eeconfig read keyboard data block
  *
@@ -289,7 +473,7 @@ void eeconfig_read_kb_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    eeconfig_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
     eeprom_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
 }
 /** \brief eeconfig init keyboard data block
@@ -308,7 +492,7 @@ __attribute__((weak)) void eeconfig_init_kb_datablock(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_user_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
 }
 /** \brief eeconfig read user data block
  *
@@ -326,7 +510,7 @@ void eeconfig_read_user_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_user_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    eeconfig_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
     eeprom_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
 }
 /** \brief eeconfig init user data block
@@ -28,7 +28,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 #define EECONFIG_MAGIC_NUMBER_OFF (uint16_t)0xFFFF
 
-// Dummy struct only used to calculate offsets
+#ifndef EECONFIG_BLOB_VERSION
+#    define EECONFIG_BLOB_VERSION 1 // When changing the layout of eeprom_core_t, increment this value to force a re-init
+#endif
+
+// Layout of the core configuration -- also held in RAM and checksummed when EECONFIG_BLOB_ENABLE is defined
 typedef struct PACKED {
     uint16_t magic;
     uint8_t  debug;
@@ -48,6 +52,10 @@ typedef struct PACKED {
     };
     uint32_t haptic;
     uint8_t  rgblight_ext;
+#ifdef EECONFIG_BLOB_ENABLE
+    uint8_t  blob_version;
+    uint16_t blob_crc;
+#endif
 } eeprom_core_t;
 
 /* EEPROM parameter address */
@@ -67,6 +75,10 @@ typedef struct PACKED {
 #define EECONFIG_RGB_MATRIX (uint64_t *)(offsetof(eeprom_core_t, rgb_matrix))
 #define EECONFIG_HAPTIC (uint32_t *)(offsetof(eeprom_core_t, haptic))
 #define EECONFIG_RGBLIGHT_EXTENDED (uint8_t *)(offsetof(eeprom_core_t, rgblight_ext))
+#ifdef EECONFIG_BLOB_ENABLE
+#    define EECONFIG_BLOB_VERSION_OFFSET (uint8_t *)(offsetof(eeprom_core_t, blob_version))
+#    define EECONFIG_BLOB_CRC (uint16_t *)(offsetof(eeprom_core_t, blob_crc))
+#endif
 
 // Size of EEPROM being used for core data storage
 #define EECONFIG_BASE_SIZE ((uint8_t)sizeof(eeprom_core_t))
@@ -107,6 +119,29 @@ typedef struct PACKED {
 #define EECONFIG_KEYMAP_SWAP_BACKSLASH_BACKSPACE (1 << 6)
 #define EECONFIG_KEYMAP_NKRO (1 << 7)
 
+/* Accessors for the core configuration area -- these must be used instead of eeprom_* for EECONFIG_* addresses,
+ * as when EECONFIG_BLOB_ENABLE is defined the core configuration is cached in RAM and checksummed. Addresses
+ * outside of the core configuration area are passed through to the EEPROM. */
+#ifdef EECONFIG_BLOB_ENABLE
+uint8_t  eeconfig_read_byte(const uint8_t *addr);
+uint16_t eeconfig_read_word(const uint16_t *addr);
+uint32_t eeconfig_read_dword(const uint32_t *addr);
+void     eeconfig_read_block(void *buf, const void *addr, size_t len);
+void     eeconfig_update_byte(uint8_t *addr, uint8_t value);
+void     eeconfig_update_word(uint16_t *addr, uint16_t value);
+void     eeconfig_update_dword(uint32_t *addr, uint32_t value);
+void     eeconfig_update_block(const void *buf, void *addr, size_t len);
+#else
+#    define eeconfig_read_byte(addr) eeprom_read_byte(addr)
+#    define eeconfig_read_word(addr) eeprom_read_word(addr)
+#    define eeconfig_read_dword(addr) eeprom_read_dword(addr)
+#    define eeconfig_read_block(buf, addr, len) eeprom_read_block(buf, addr, len)
+#    define eeconfig_update_byte(addr, value) eeprom_update_byte(addr, value)
+#    define eeconfig_update_word(addr, value) eeprom_update_word(addr, value)
+#    define eeconfig_update_dword(addr, value) eeprom_update_dword(addr, value)
+#    define eeconfig_update_block(buf, addr, len) eeprom_update_block(buf, addr, len)
+#endif
+
 bool eeconfig_is_enabled(void);
 bool eeconfig_is_disabled(void);
 
@@ -177,13 +212,13 @@ void eeconfig_init_user_datablock(void);
     static inline void eeconfig_init_##name(void) {                     \
         dirty_##name = true;                                            \
         if (eeconfig_check_valid_##name()) {                            \
-            eeprom_read_block(&config, offset, sizeof(config));         \
+            eeconfig_read_block(&config, offset, sizeof(config));       \
             dirty_##name = false;                                       \
         }                                                               \
     }                                                                   \
     static inline void eeconfig_flush_##name(bool force) {              \
         if (force || dirty_##name) {                                    \
-            eeprom_update_block(&config, offset, sizeof(config));       \
+            eeconfig_update_block(&config, offset, sizeof(config));     \
             eeconfig_post_flush_##name();                               \
             dirty_##name = false;                                       \
         }                                                               \
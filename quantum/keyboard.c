@@ -110,6 +110,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -748,4 +751,12 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#if defined(EEPROM_DRIVER) && defined(EEPROM_ASYNC_ENABLE)
+    eeprom_driver_task();
+#endif
+
+#ifdef WEAR_LEVELING_ENABLE
+    wear_leveling_task();
+#endif
 }
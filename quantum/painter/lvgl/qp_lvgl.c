@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
@@ -17,21 +19,67 @@ static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_ta
 static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
 
 painter_device_t selected_display = NULL;
-void *           color_buffer     = NULL;
+
+// LVGL renders into one buffer while the other is being sent to the display
+__attribute__((__aligned__(4))) static lv_color_t color_buffers[2][QP_LVGL_DRAW_BUFFER_PIXELS];
+
+// Display driver whose flush is still being transmitted, if any
+static lv_disp_drv_t *flush_pending_disp = NULL;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+// Hands the draw buffer back to LVGL once the display has finished receiving it
+static void qp_lvgl_flush_complete(void) {
+    if (flush_pending_disp && !qp_comms_busy(selected_display)) {
+        lv_disp_drv_t *disp = flush_pending_disp;
+        flush_pending_disp  = NULL;
+        lv_disp_flush_ready(disp);
+    }
+}
+
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+// Panels expect big-endian RGB565, so byte-swap LVGL's pixels through the pixdata buffer
+static void qp_lvgl_pixdata(const lv_color_t *color_p, uint32_t number_pixels) {
+    const uint32_t max_pixels = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(lv_color_t);
+    while (number_pixels > 0) {
+        qp_internal_acquire_pixdata_buffer();
+        uint32_t  pixels_this_loop = QP_MIN(number_pixels, max_pixels);
+        uint16_t *buffer           = (uint16_t *)qp_internal_global_pixdata_buffer;
+        for (uint32_t i = 0; i < pixels_this_loop; ++i) {
+            buffer[i] = __builtin_bswap16(color_p[i].full);
+        }
+        qp_pixdata(selected_display, buffer, pixels_this_loop);
+        qp_internal_swap_pixdata_buffer();
+        color_p += pixels_this_loop;
+        number_pixels -= pixels_this_loop;
+    }
+}
+#else  // LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+// lv_color_t already matches the panel's native pixel format, so LVGL's buffer is sent as-is
+static void qp_lvgl_pixdata(const lv_color_t *color_p, uint32_t number_pixels) {
+    qp_pixdata(selected_display, (const void *)color_p, number_pixels);
+}
+#endif // LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
+        qp_lvgl_pixdata(color_p, number_pixels);
         qp_flush(selected_display);
-        lv_disp_flush_ready(disp);
+
+        // The transfer may still be in progress, in which case LVGL is told the buffer is free once it completes
+        flush_pending_disp = disp;
+        qp_lvgl_flush_complete();
     }
 }
 
+// Invoked by LVGL while it waits for a buffer to become free
+static void qp_lvgl_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_complete();
+}
+
 static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
     lvgl_state_t *  state     = (lvgl_state_t *)cb_arg;
     static uint32_t last_tick = 0;
@@ -67,6 +115,12 @@ bool qp_lvgl_attach(painter_device_t device) {
         return false;
     }
 
+    if (driver->native_bits_per_pixel != LV_COLOR_DEPTH) {
+        qp_dprintf("qp_lvgl_attach: fail (display pixel format does not match LV_COLOR_DEPTH)\n");
+        qp_lvgl_detach();
+        return false;
+    }
+
     // Setting up the tasks
     lvgl_state_t *lv_tick_inc_state = &lvgl_states[0];
     lv_tick_inc_state->fnc_id       = 0;
@@ -93,20 +147,15 @@ bool qp_lvgl_attach(painter_device_t device) {
     // Init LVGL
     lv_init();
 
-    // Set up lvgl display buffer
+    // Set up lvgl display buffers, no larger than the screen itself
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
-    if (!new_color_buffer) {
-        qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
-        qp_lvgl_detach();
-        return false;
-    }
-    color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
-    // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    const uint32_t            count_required = QP_MIN((uint32_t)driver->panel_width * driver->panel_height, QP_LVGL_DRAW_BUFFER_PIXELS);
+    lv_disp_draw_buf_init(&draw_buf, color_buffers[0], color_buffers[1], count_required);
+
+#if QUANTUM_PAINTER_ASYNC_PIXDATA && !(LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0)
+    // LVGL doesn't touch a buffer until told that it has been flushed, so the buffers can be sent in the background
+    qp_internal_set_async_pixdata_region(color_buffers, sizeof(color_buffers));
+#endif
 
     selected_display = device;
 
@@ -117,6 +166,7 @@ bool qp_lvgl_attach(painter_device_t device) {
     static lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
     lv_disp_drv_init(&disp_drv);       /*Basic initialization*/
     disp_drv.flush_cb = qp_lvgl_flush; /*Set your driver function*/
+    disp_drv.wait_cb  = qp_lvgl_wait;  /*Poll for completion of asynchronous flushes*/
     disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
     disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
     disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
@@ -132,10 +182,15 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
-    if (color_buffer) {
-        free(color_buffer);
-        color_buffer = NULL;
+    if (flush_pending_disp) {
+        // Make sure the display isn't still receiving one of the buffers
+        while (qp_comms_busy(selected_display)) {
+        }
+        flush_pending_disp = NULL;
     }
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    qp_internal_set_async_pixdata_region(NULL, 0);
+#endif
     selected_display = NULL;
 }
 
@@ -143,6 +198,8 @@ void qp_lvgl_detach(void) {
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
+    qp_lvgl_flush_complete();
+
     static uint32_t last_lvgl_exec = 0;
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
 }
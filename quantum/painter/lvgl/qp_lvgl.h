@@ -11,6 +11,11 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+#ifndef QP_LVGL_DRAW_BUFFER_PIXELS
+// Size of each of LVGL's two draw buffers, in pixels -- defaults to 16 lines of a 240 pixel wide display
+#    define QP_LVGL_DRAW_BUFFER_PIXELS (240 * 16)
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
@@ -92,8 +92,21 @@ static bool qff_validate_unicode_descriptor(qp_stream_t *stream, uint16_t num_un
         return false;
     }
 
-    // Skip the necessary amount of data to get to the next block
-    qp_stream_seek(stream, num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t), SEEK_CUR);
+    // Make sure the glyphs are sorted by code point, as lookups binary search the table
+    qff_unicode_glyph_v1_t glyph_info;
+    uint32_t               prev_code_point = 0;
+    for (uint16_t i = 0; i < num_unicode_glyphs; ++i) {
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, stream) != 1) {
+            qp_dprintf("Failed to read unicode glyph info\n");
+            return false;
+        }
+
+        if (i > 0 && glyph_info.code_point <= prev_code_point) {
+            qp_dprintf("Failed to validate unicode_descriptor, code point 0x%06X is out of order\n", (int)glyph_info.code_point);
+            return false;
+        }
+        prev_code_point = glyph_info.code_point;
+    }
 
     return true;
 }
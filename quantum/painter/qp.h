@@ -56,6 +56,42 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the number of decoded glyphs that Quantum Painter keeps in RAM, in the target display's native
+ *      pixel format. Redrawing a cached glyph with the same colors on the same display skips decoding entirely. The
+ *      least recently used glyph is evicted when the cache is full. Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the size in bytes of each glyph cache entry. Glyphs whose native pixel data is larger than this
+ *      are still drawn, but are never cached. RAM usage is roughly QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES multiplied by
+ *      this value.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 256
+#endif
+
+#ifndef QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES
+/**
+ * @def This controls the number of palettes of up to 16 colors that Quantum Painter keeps in RAM once converted to a
+ *      display's native pixel format. Redrawing recolored text or images with colors used recently on the same display
+ *      skips palette conversion. The least recently used palette is evicted when the cache is full. Each entry requires
+ *      roughly 90 bytes of RAM. Defaults to 0, which only reuses the most recently converted palette.
+ */
+#    define QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS
+/**
+ * @def This controls the maximum number of glyphs that can be held by a \ref painter_prepared_text_t. Each glyph
+ *      requires 8 bytes of RAM in every prepared text object.
+ */
+#    define QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS 32
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +108,32 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_PIXDATA
+/**
+ * @def This controls whether the pixel data buffer is double-buffered, allowing transmission of one buffer to the
+ *      display to continue in the background while the next is being decoded. Transmission is only asynchronous for
+ *      SPI displays on platforms supporting DMA-based SPI, but the second buffer still consumes
+ *      \ref QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM regardless.
+ */
+#    define QUANTUM_PAINTER_ASYNC_PIXDATA FALSE
+#endif
+
+#ifndef QUANTUM_PAINTER_COMMAND_LIST_SIZE
+/**
+ * @def This controls the size in bytes of the command list used to defer draw calls made between
+ *      \ref qp_command_list_begin and \ref qp_command_list_end. Defaults to 0, which disables the command list.
+ */
+#    define QUANTUM_PAINTER_COMMAND_LIST_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_COMMAND_LIST_TIME_BUDGET
+/**
+ * @def This controls the number of milliseconds spent executing deferred draw calls per Quantum Painter task
+ *      iteration. At least one draw call, or one band of an image, is executed per iteration regardless.
+ */
+#    define QUANTUM_PAINTER_COMMAND_LIST_TIME_BUDGET 2
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +191,27 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef A single glyph of a \ref painter_prepared_text_t.
+ */
+typedef struct painter_prepared_glyph_t {
+    uint32_t data_offset;     ///< The offset of the glyph's pixel data within the font
+    uint32_t code_point : 24; ///< The code point this glyph represents
+    uint32_t width : 8;       ///< The width of the glyph, in pixels
+} painter_prepared_glyph_t;
+
+/**
+ * @typedef A string which has been decoded and had its glyphs located within a font, so that it can be drawn repeatedly
+ *          without redoing that work. Created by \ref qp_prepare_text, drawn with \ref qp_drawtext_prepared.
+ */
+typedef struct painter_prepared_text_t {
+    painter_font_handle_t    font;            ///< The font the text was prepared with, NULL if preparation failed
+    uint8_t                  font_generation; ///< Identifies the font in case its handle is closed and reused
+    int16_t                  width;           ///< The width of the text, in pixels
+    uint8_t                  num_glyphs;      ///< The number of glyphs in the text
+    painter_prepared_glyph_t glyphs[QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS];
+} painter_prepared_text_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -488,6 +571,89 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Decodes the supplied string and locates each of its glyphs within the font, so that it can be measured and drawn
+ * repeatedly without doing so again. The prepared text remains valid until the font is closed.
+ *
+ * @param prepared[out] the prepared text to fill in
+ * @param font[in] the handle of the font
+ * @param str[in] the string to prepare
+ * @return true if preparing the text succeeded
+ * @return false if preparing the text failed, such as a missing glyph or exceeding
+ *         \ref QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS
+ */
+bool qp_prepare_text(painter_prepared_text_t *prepared, painter_font_handle_t font, const char *str);
+
+/**
+ * Re-prepares the supplied text only if the string or font differ from what it was last prepared with. Intended for
+ * status widgets which are refreshed frequently but whose contents rarely change.
+ *
+ * @param prepared[in,out] the prepared text to update
+ * @param font[in] the handle of the font
+ * @param str[in] the string to prepare
+ * @return true if the prepared text changed, and needs to be redrawn
+ * @return false if the prepared text is unchanged, or preparing it failed -- in which case prepared->font is NULL
+ */
+bool qp_prepare_text_if_changed(painter_prepared_text_t *prepared, painter_font_handle_t font, const char *str);
+
+/**
+ * Draws prepared text to the display.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param prepared[in] the text to draw, created by \ref qp_prepare_text
+ * @return the width (in pixels) used when drawing the specified text
+ */
+int16_t qp_drawtext_prepared(painter_device_t device, uint16_t x, uint16_t y, const painter_prepared_text_t *prepared);
+
+/**
+ * Draws prepared text to the display, recoloring monochrome fonts to the desired foreground/background.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param prepared[in] the text to draw, created by \ref qp_prepare_text
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the width (in pixels) used when drawing the specified text
+ */
+int16_t qp_drawtext_prepared_recolor(painter_device_t device, uint16_t x, uint16_t y, const painter_prepared_text_t *prepared, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Starts recording draw calls into the command list, instead of executing them immediately.
+ *
+ * Calls to \ref qp_setpixel, \ref qp_line, \ref qp_rect, \ref qp_circle, \ref qp_ellipse, \ref qp_drawimage,
+ * \ref qp_drawtext and \ref qp_drawtext_prepared (and their recolor variants) are recorded, and are executed later by
+ * the Quantum Painter task, within the time budget specified by \ref QUANTUM_PAINTER_COMMAND_LIST_TIME_BUDGET. Recorded calls return true, or
+ * the text width for text, if they were successfully added to the command list.
+ *
+ * @note Requires \ref QUANTUM_PAINTER_COMMAND_LIST_SIZE to be non-zero.
+ *
+ * @return whether recording was started
+ */
+bool qp_command_list_begin(void);
+
+/**
+ * Stops recording draw calls; subsequent draw calls are executed immediately. Draw calls already recorded are still
+ * executed by the Quantum Painter task.
+ *
+ * @note \ref qp_flush is not recorded -- flush only once \ref qp_command_list_done returns true, otherwise the display
+ *       is flushed before the recorded draw calls have been executed.
+ */
+void qp_command_list_end(void);
+
+/**
+ * Checks whether all recorded draw calls have been executed.
+ *
+ * @return true if the command list is empty
+ */
+bool qp_command_list_done(void);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -0,0 +1,155 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_command_list.h"
+
+#if QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Command list storage
+
+// Commands are stored back-to-back, each padded so that the next one is suitably aligned
+#    define QP_COMMAND_ALIGN (sizeof(void *))
+#    define QP_COMMAND_PADDED_LENGTH(len) (((len) + QP_COMMAND_ALIGN - 1) & ~(QP_COMMAND_ALIGN - 1))
+
+static union {
+    qp_command_t first;
+    uint8_t      buffer[QUANTUM_PAINTER_COMMAND_LIST_SIZE];
+} command_list;
+
+// Positions and command lengths are held as uint16_t
+_Static_assert((QUANTUM_PAINTER_COMMAND_LIST_SIZE) <= UINT16_MAX, "QUANTUM_PAINTER_COMMAND_LIST_SIZE must be no larger than 65535");
+
+static uint16_t read_pos  = 0;
+static uint16_t write_pos = 0;
+static bool     recording = false;
+static bool     executing = false;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_command_list_begin
+
+bool qp_command_list_begin(void) {
+    recording = true;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_command_list_end
+
+void qp_command_list_end(void) {
+    recording = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_command_list_done
+
+bool qp_command_list_done(void) {
+    return read_pos == write_pos;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: qp_internal_command_list_recording
+
+bool qp_internal_command_list_recording(void) {
+    // Draw calls made while executing the command list must not be recorded again
+    return recording && !executing;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: qp_internal_command_list_record
+
+bool qp_internal_command_list_record(qp_command_t *command, const void *data, size_t data_length) {
+    size_t length = QP_COMMAND_PADDED_LENGTH(sizeof(qp_command_t) + (data ? data_length : 0));
+    if (length > sizeof(command_list.buffer) - write_pos) {
+        qp_dprintf("qp_internal_command_list_record: fail (command list full)\n");
+        return false;
+    }
+
+    command->length = length;
+    memcpy(&command_list.buffer[write_pos], command, sizeof(qp_command_t));
+    if (data) {
+        memcpy(&command_list.buffer[write_pos + sizeof(qp_command_t)], data, data_length);
+    }
+    write_pos += length;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: qp_internal_command_list_task
+
+// Executes a command, or the next part of it -- returns true once the command has been completed
+static bool qp_command_list_execute(qp_command_t *command) {
+    switch (command->type) {
+        case QP_COMMAND_SETPIXEL:
+            qp_setpixel(command->device, command->x0, command->y0, command->hue_fg, command->sat_fg, command->val_fg);
+            return true;
+        case QP_COMMAND_LINE:
+            qp_line(command->device, command->x0, command->y0, command->x1, command->y1, command->hue_fg, command->sat_fg, command->val_fg);
+            return true;
+        case QP_COMMAND_RECT:
+            qp_rect(command->device, command->x0, command->y0, command->x1, command->y1, command->hue_fg, command->sat_fg, command->val_fg, command->filled);
+            return true;
+        case QP_COMMAND_CIRCLE:
+            qp_circle(command->device, command->x0, command->y0, command->x1, command->hue_fg, command->sat_fg, command->val_fg, command->filled);
+            return true;
+        case QP_COMMAND_ELLIPSE:
+            qp_ellipse(command->device, command->x0, command->y0, command->x1, command->y1, command->hue_fg, command->sat_fg, command->val_fg, command->filled);
+            return true;
+        case QP_COMMAND_DRAWIMAGE: {
+            // Images are drawn a band of rows at a time, so that large images don't blow the time budget
+            qp_pixel_t                        fg_hsv888 = {.hsv888 = {.h = command->hue_fg, .s = command->sat_fg, .v = command->val_fg}};
+            qp_pixel_t                        bg_hsv888 = {.hsv888 = {.h = command->hue_bg, .s = command->sat_bg, .v = command->val_bg}};
+            qp_internal_drawimage_progress_t *progress  = &command->drawimage.progress;
+            if (!qp_internal_drawimage_recolor_rows(command->device, command->x0, command->y0, command->drawimage.image, fg_hsv888, bg_hsv888, progress, qp_internal_num_pixels_in_buffer(command->device))) {
+                return true;
+            }
+            return progress->next_row >= command->drawimage.image->height;
+        }
+        case QP_COMMAND_DRAWTEXT:
+            qp_drawtext_recolor(command->device, command->x0, command->y0, command->drawtext.font, (const char *)(command + 1), command->hue_fg, command->sat_fg, command->val_fg, command->hue_bg, command->sat_bg, command->val_bg);
+            return true;
+        case QP_COMMAND_DRAWTEXT_PREPARED:
+            qp_drawtext_prepared_recolor(command->device, command->x0, command->y0, (const painter_prepared_text_t *)(command + 1), command->hue_fg, command->sat_fg, command->val_fg, command->hue_bg, command->sat_bg, command->val_bg);
+            return true;
+        default:
+            return true;
+    }
+}
+
+void qp_internal_command_list_task(void) {
+    if (read_pos == write_pos) {
+        return;
+    }
+
+    // Always make some progress, then keep going until the time budget is exhausted
+    uint32_t start = timer_read32();
+    executing      = true;
+    do {
+        qp_command_t *command = (qp_command_t *)&command_list.buffer[read_pos];
+        if (qp_command_list_execute(command)) {
+            read_pos += command->length;
+        }
+    } while (read_pos != write_pos && timer_elapsed32(start) < (QUANTUM_PAINTER_COMMAND_LIST_TIME_BUDGET));
+    executing = false;
+
+    // Once drained, start again from the beginning of the buffer
+    if (read_pos == write_pos) {
+        read_pos  = 0;
+        write_pos = 0;
+    }
+}
+
+#else // QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
+
+bool qp_command_list_begin(void) {
+    return false;
+}
+
+void qp_command_list_end(void) {}
+
+bool qp_command_list_done(void) {
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
@@ -0,0 +1,83 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp_internal.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter command list
+
+typedef enum qp_command_type_t {
+    QP_COMMAND_SETPIXEL,
+    QP_COMMAND_LINE,
+    QP_COMMAND_RECT,
+    QP_COMMAND_CIRCLE,
+    QP_COMMAND_ELLIPSE,
+    QP_COMMAND_DRAWIMAGE,
+    QP_COMMAND_DRAWTEXT,
+    QP_COMMAND_DRAWTEXT_PREPARED,
+} qp_command_type_t;
+
+// Progress of an image which is drawn incrementally, a band of rows at a time
+typedef struct qp_internal_drawimage_progress_t {
+    uint16_t                       next_row;    // first row not yet drawn, 0 if not yet started
+    uint32_t                       stream_pos;  // position in the image stream to continue decoding from
+    qp_internal_byte_input_state_t input_state; // decoder state to continue decoding with
+} qp_internal_drawimage_progress_t;
+
+// A recorded draw call. Coordinates and colors are interpreted according to the command type, matching the
+// parameters of the corresponding qp_* function. Text commands are immediately followed by their NUL-terminated string,
+// prepared text commands by the prepared text, truncated after its last glyph.
+typedef struct qp_command_t {
+    uint8_t          type;
+    uint16_t         length; // total length of the record, including any trailing text
+    painter_device_t device;
+    uint16_t         x0;
+    uint16_t         y0;
+    uint16_t         x1;
+    uint16_t         y1;
+    uint8_t          hue_fg;
+    uint8_t          sat_fg;
+    uint8_t          val_fg;
+    uint8_t          hue_bg;
+    uint8_t          sat_bg;
+    uint8_t          val_bg;
+    bool             filled;
+    union {
+        struct {
+            painter_image_handle_t           image;
+            qp_internal_drawimage_progress_t progress;
+        } drawimage;
+        struct {
+            painter_font_handle_t font;
+        } drawtext;
+    };
+} qp_command_t;
+
+#if QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
+
+// Check if draw calls should be recorded rather than executed
+bool qp_internal_command_list_recording(void);
+
+// Appends a command to the command list, followed by data_length bytes of data if non-NULL
+bool qp_internal_command_list_record(qp_command_t *command, const void *data, size_t data_length);
+
+// Executes recorded commands, within the configured time budget
+void qp_internal_command_list_task(void);
+
+#else // QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
+
+static inline bool qp_internal_command_list_recording(void) {
+    return false;
+}
+
+static inline bool qp_internal_command_list_record(qp_command_t *command, const void *data, size_t data_length) {
+    return false;
+}
+
+#endif // QUANTUM_PAINTER_COMMAND_LIST_SIZE > 0
+
+// Draws the next band of rows of an image, of roughly max_pixels in size, updating the supplied progress
+bool qp_internal_drawimage_recolor_rows(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_drawimage_progress_t *progress, uint32_t max_pixels);
@@ -46,6 +46,16 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+bool qp_comms_busy(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_busy: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    return driver->comms_vtable->comms_busy && driver->comms_vtable->comms_busy(device);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -10,8 +10,29 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Switches qp_internal_global_pixdata_buffer to the other buffer, so it can be refilled while the previous one is sent.
+// Must be invoked after the contents of the buffer have been handed to the device, before writing to it again.
+void qp_internal_swap_pixdata_buffer(void);
+
+// Ensures qp_internal_global_pixdata_buffer is not still being transmitted, before starting to fill it.
+void qp_internal_acquire_pixdata_buffer(void);
+
+// Check if the supplied data lies within the pixdata buffers, and can therefore be transmitted asynchronously
+bool qp_internal_is_pixdata_buffer(const void* data);
+
+// Allows an additional region of memory to be transmitted asynchronously, for owners which leave it untouched until
+// qp_comms_busy() reports completion. Passing NULL removes the region.
+void qp_internal_set_async_pixdata_region(const void* data, uint32_t byte_count);
+#else  // QUANTUM_PAINTER_ASYNC_PIXDATA
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+static inline void qp_internal_swap_pixdata_buffer(void) {}
+static inline void qp_internal_acquire_pixdata_buffer(void) {}
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 
@@ -44,16 +65,26 @@ extern qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
 // Generates a color-interpolated lookup table based off the number of items, from foreground to background, for use with monochrome image rendering.
-// Returns true if a palette was created, false if the palette is reused.
-// As this uses a global, this may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() below to reset.
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+void qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Only needed if the lookup table has been overwritten outside of the functions in this file.
 void qp_internal_invalidate_palette(void);
 
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
 bool qp_internal_load_qgf_palette(qp_stream_t* stream, uint8_t bpp);
 
+// As per qp_internal_interpolate_palette(), but also converts the lookup table to the device's native pixel format.
+// Conversion is skipped if the lookup table already holds this palette for this device, or if it is held in the palette cache.
+bool qp_internal_interpolate_native_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+
+// As per qp_internal_load_qgf_palette(), but also converts the lookup table to the device's native pixel format.
+// Conversion is skipped if the lookup table already holds this palette for this device, or if it is held in the palette cache.
+// The stream is left positioned after the palette block regardless.
+bool qp_internal_load_native_qgf_palette(painter_device_t device, qp_stream_t* stream, uint8_t bpp);
+
+// Forgets any converted palettes which were loaded from the supplied stream -- must be invoked before the stream is closed.
+void qp_internal_invalidate_palette_source(const void* source);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter codec functions
 
@@ -63,6 +94,14 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+enum qp_internal_lz_mode_t {
+    LZ_LITERAL_RUN,
+    LZ_MATCH,
+};
+
+// Back-references in LZ-compressed data can reach at most this many bytes into the already-decoded output
+#define QP_LZ_WINDOW_SIZE 256
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -73,6 +112,13 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            enum qp_internal_lz_mode_t mode;
+            uint8_t                    remain;     // number of bytes remaining in the current literal run or match
+            uint8_t                    distance;   // distance back into the window for the current match, minus one
+            uint8_t                    window_pos; // write position in the window, wrapping at QP_LZ_WINDOW_SIZE
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
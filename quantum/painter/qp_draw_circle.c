@@ -6,6 +6,7 @@
 #include "qp_internal.h"
 #include "qp_comms.h"
 #include "qp_draw.h"
+#include "qp_command_list.h"
 
 // Utilize 8-way symmetry to draw circles
 static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
@@ -126,6 +127,11 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
 // Quantum Painter External API: qp_circle
 
 bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_CIRCLE, .device = device, .x0 = x, .y0 = y, .x1 = radius, .hue_fg = hue, .sat_fg = sat, .val_fg = val, .filled = filled};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     qp_dprintf("qp_circle: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
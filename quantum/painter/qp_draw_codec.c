@@ -55,12 +55,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (!qp_internal_interpolate_native_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        return false;
     }
 
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
@@ -126,10 +123,58 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+// Decoded output is shared between all LZ decodes, as only one asset is ever decoded at a time
+static uint8_t qp_internal_lz_window[QP_LZ_WINDOW_SIZE];
+
+_Static_assert(QP_LZ_WINDOW_SIZE == 256, "LZ window position relies on uint8_t wraparound");
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    // Work out if we're parsing the next token
+    if (state->lz.remain == 0) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return -1;
+        }
+        if (c >= 128) {
+            int16_t d = qp_stream_get(state->src_stream);
+            if (d < 0) {
+                return -1;
+            }
+            state->lz.mode     = LZ_MATCH; // copy from the window
+            state->lz.remain   = (c - 128) + 3;
+            state->lz.distance = d;
+        } else {
+            state->lz.mode   = LZ_LITERAL_RUN; // literal run
+            state->lz.remain = c + 1;
+        }
+    }
+
+    // Work out which byte we're returning
+    if (state->lz.mode == LZ_MATCH) {
+        state->curr = qp_internal_lz_window[(uint8_t)(state->lz.window_pos - state->lz.distance - 1)];
+    } else {
+        state->curr = qp_stream_get(state->src_stream);
+        if (state->curr < 0) {
+            return -1;
+        }
+    }
+
+    // Record the byte in the window for later matches
+    qp_internal_lz_window[state->lz.window_pos++] = state->curr;
+    state->lz.remain--;
+    return state->curr;
+}
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
 
+    if (state->pixel_write_pos == 0) {
+        qp_internal_acquire_pixdata_buffer();
+    }
+
     if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
         return false;
     }
@@ -139,6 +184,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->pixel_write_pos = 0;
     }
 
@@ -149,6 +195,10 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
     painter_driver_t*                driver = (painter_driver_t*)state->device;
 
+    if (state->byte_write_pos == 0) {
+        qp_internal_acquire_pixdata_buffer();
+    }
+
     if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
         return false;
     }
@@ -159,6 +209,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
         state->byte_write_pos = 0;
     }
 
@@ -181,6 +232,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
@@ -198,6 +250,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
             ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            qp_internal_swap_pixdata_buffer();
         }
     }
 
@@ -212,6 +265,11 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.mode       = LZ_LITERAL_RUN;
+            input_state->lz.remain     = 0;
+            input_state->lz.window_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
         default:
             return NULL;
     }
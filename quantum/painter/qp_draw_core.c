@@ -5,6 +5,7 @@
 #include "qp_internal.h"
 #include "qp_comms.h"
 #include "qp_draw.h"
+#include "qp_command_list.h"
 #include "qgf.h"
 
 _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE % 16) == 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE needs to be a non-zero multiple of 16");
@@ -20,13 +21,25 @@ _Static_assert((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIX
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t *                                      qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+#else  // QUANTUM_PAINTER_ASYNC_PIXDATA
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
+// Describes the native palette currently held in qp_internal_global_pixel_lookup_table
+typedef struct qp_internal_palette_key_t {
+    painter_device_t device;   // NULL if the lookup table doesn't hold a native palette
+    const void *     source;   // stream the palette was loaded from, NULL if interpolated
+    uint32_t         position; // position of the palette block in the source stream
+    qp_pixel_t       fg_hsv888;
+    qp_pixel_t       bg_hsv888;
+    int16_t          steps;
+} qp_internal_palette_key_t;
 
 // Static buffer to contain a generated color palette
-static bool                                       generated_palette = false;
-static int16_t                                    generated_steps   = -1;
-__attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
-__attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
+static qp_internal_palette_key_t generated_key = {0};
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[256];
 #else
@@ -36,6 +49,40 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+// Whether the current pixdata buffer was sent without being swapped, and may therefore still be in transmission
+static bool pixdata_buffer_busy = false;
+
+void qp_internal_swap_pixdata_buffer(void) {
+    // Only the most recently sent buffer can be in transmission, so the other one is always safe to write to
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+    pixdata_buffer_busy               = false;
+}
+
+void qp_internal_acquire_pixdata_buffer(void) {
+    if (pixdata_buffer_busy) {
+        qp_internal_swap_pixdata_buffer();
+    }
+}
+
+// Additional region which may be transmitted asynchronously, such as LVGL's draw buffers
+static const uint8_t *async_region_start = NULL;
+static const uint8_t *async_region_end   = NULL;
+
+void qp_internal_set_async_pixdata_region(const void *data, uint32_t byte_count) {
+    async_region_start = (const uint8_t *)data;
+    async_region_end   = data ? async_region_start + byte_count : NULL;
+}
+
+bool qp_internal_is_pixdata_buffer(const void *data) {
+    const uint8_t *p = (const uint8_t *)data;
+    if (p >= async_region_start && p < async_region_end) {
+        return true;
+    }
+    return p >= &qp_internal_pixdata_buffers[0][0] && p < &qp_internal_pixdata_buffers[1][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+}
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
+
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
@@ -44,6 +91,10 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // The buffer is resent unmodified by subsequent calls, so it's only swapped once something else needs to write to it
+    pixdata_buffer_busy = true;
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
     return driver->driver_vtable->viewport(device, x, y, x, y) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, 1);
 }
 
@@ -58,32 +109,22 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     driver->driver_vtable->palette_convert(device, 1, &color);
 
     // Append the required number of pixels
+    qp_internal_acquire_pixdata_buffer();
     uint8_t palette_idx = 0;
     for (uint32_t i = 0; i < num_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Only needed if the lookup table has been overwritten outside of the functions below.
 void qp_internal_invalidate_palette(void) {
-    generated_palette = false;
-    generated_steps   = -1;
+    generated_key.device = NULL;
 }
 
 // Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
-    // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
-        // We already have the correct palette, no point regenerating it.
-        return false;
-    }
-
-    // Save the parameters so we know whether we can skip generation
-    generated_palette      = true;
-    generated_steps        = steps;
-    interpolated_fg_hsv888 = fg_hsv888;
-    interpolated_bg_hsv888 = bg_hsv888;
+void qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    // The lookup table no longer holds native pixels
+    qp_internal_invalidate_palette();
 
     int16_t hue_fg = fg_hsv888.hsv888.h;
     int16_t hue_bg = bg_hsv888.hsv888.h;
@@ -103,8 +144,6 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
 
         qp_dprintf("qp_internal_interpolate_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)steps, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
     }
-
-    return true;
 }
 
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
@@ -140,10 +179,146 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Native palette cache
+
+static inline bool qp_internal_palette_key_equal(const qp_internal_palette_key_t *a, const qp_internal_palette_key_t *b) {
+    return a->device == b->device && a->source == b->source && a->position == b->position && a->steps == b->steps                                                                              //
+           && a->fg_hsv888.hsv888.h == b->fg_hsv888.hsv888.h && a->fg_hsv888.hsv888.s == b->fg_hsv888.hsv888.s && a->fg_hsv888.hsv888.v == b->fg_hsv888.hsv888.v //
+           && a->bg_hsv888.hsv888.h == b->bg_hsv888.hsv888.h && a->bg_hsv888.hsv888.s == b->bg_hsv888.hsv888.s && a->bg_hsv888.hsv888.v == b->bg_hsv888.hsv888.v;
+}
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+// Palette which has already been converted to the native pixel format of a device
+typedef struct qp_palette_cache_entry_t {
+    qp_internal_palette_key_t key; // key.device is NULL if this entry is unused
+    uint32_t                  last_used;
+    qp_pixel_t                palette[16];
+} qp_palette_cache_entry_t;
+
+static qp_palette_cache_entry_t palette_cache[QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES] = {0};
+static uint32_t                 palette_cache_tick                                   = 0;
+
+// Copies a matching palette out of the cache into the global lookup table, if present
+static bool qp_palette_cache_restore(const qp_internal_palette_key_t *key) {
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &palette_cache[i];
+        if (entry->key.device != NULL && qp_internal_palette_key_equal(&entry->key, key)) {
+            entry->last_used = ++palette_cache_tick;
+            memcpy(qp_internal_global_pixel_lookup_table, entry->palette, key->steps * sizeof(qp_pixel_t));
+            generated_key = *key;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Saves the freshly-converted global lookup table into the cache, evicting the least recently used entry if full
+static void qp_palette_cache_store(const qp_internal_palette_key_t *key) {
+    if (key->steps > (int16_t)(sizeof(palette_cache[0].palette) / sizeof(qp_pixel_t))) {
+        return;
+    }
+
+    qp_palette_cache_entry_t *victim = &palette_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &palette_cache[i];
+        if (entry->key.device == NULL) {
+            victim = entry;
+            break;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    victim->key       = *key;
+    victim->last_used = ++palette_cache_tick;
+    memcpy(victim->palette, qp_internal_global_pixel_lookup_table, key->steps * sizeof(qp_pixel_t));
+}
+
+#else // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+static inline bool qp_palette_cache_restore(const qp_internal_palette_key_t *key) {
+    return false;
+}
+
+static inline void qp_palette_cache_store(const qp_internal_palette_key_t *key) {}
+
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+// Converts the global lookup table to the native format of the device, recording what it now holds
+static bool qp_internal_convert_palette(const qp_internal_palette_key_t *key) {
+    painter_driver_t *driver = (painter_driver_t *)key->device;
+    if (!driver->driver_vtable->palette_convert(key->device, key->steps, qp_internal_global_pixel_lookup_table)) {
+        return false;
+    }
+
+    generated_key = *key;
+    qp_palette_cache_store(key);
+    return true;
+}
+
+// Sets up the global lookup table with native pixels interpolated from fg/bg, skipping conversion if already done for this device
+bool qp_internal_interpolate_native_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    qp_internal_palette_key_t key = {.device = device, .fg_hsv888 = fg_hsv888, .bg_hsv888 = bg_hsv888, .steps = steps};
+
+    // Check if the lookup table already holds the correct palette
+    if (generated_key.device != NULL && qp_internal_palette_key_equal(&generated_key, &key)) {
+        return true;
+    }
+
+    if (qp_palette_cache_restore(&key)) {
+        return true;
+    }
+
+    qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps);
+    return qp_internal_convert_palette(&key);
+}
+
+// Sets up the global lookup table with native pixels matching the palette block in the asset, skipping conversion if already done for this device.
+// Expects the stream to be positioned at the start of the block header, and leaves it positioned after the block.
+bool qp_internal_load_native_qgf_palette(painter_device_t device, qp_stream_t *stream, uint8_t bpp) {
+    const uint16_t            palette_entries = 1u << bpp;
+    qp_internal_palette_key_t key             = {.device = device, .source = stream, .position = qp_stream_tell(stream), .steps = palette_entries};
+
+    // Check if the lookup table already holds the correct palette, skipping over the block if so
+    if ((generated_key.device != NULL && qp_internal_palette_key_equal(&generated_key, &key)) || qp_palette_cache_restore(&key)) {
+        qp_stream_setpos(stream, key.position + sizeof(qgf_palette_v1_t) + (palette_entries * sizeof(qgf_palette_entry_v1_t)));
+        return true;
+    }
+
+    if (!qp_internal_load_qgf_palette(stream, bpp)) {
+        return false;
+    }
+
+    return qp_internal_convert_palette(&key);
+}
+
+// Forgets any palettes loaded from the supplied stream, as the stream is about to be closed and may be reused by a different asset
+void qp_internal_invalidate_palette_source(const void *source) {
+    if (generated_key.source == source) {
+        qp_internal_invalidate_palette();
+    }
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        if (palette_cache[i].key.source == source) {
+            palette_cache[i].key.device = NULL;
+        }
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_setpixel
 
 bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, uint8_t sat, uint8_t val) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_SETPIXEL, .device = device, .x0 = x, .y0 = y, .hue_fg = hue, .sat_fg = sat, .val_fg = val};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
         qp_dprintf("qp_setpixel: fail (validation_ok == false)\n");
@@ -166,6 +341,11 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
 // Quantum Painter External API: qp_line
 
 bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_LINE, .device = device, .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1, .hue_fg = hue, .sat_fg = sat, .val_fg = val};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     if (x0 == x1 || y0 == y1) {
         qp_dprintf("qp_line(%d, %d, %d, %d): entry (deferring to qp_rect)\n", (int)x0, (int)y0, (int)x1, (int)y1);
         bool ret = qp_rect(device, x0, y0, x1, y1, hue, sat, val, true);
@@ -240,6 +420,10 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
 
     uint32_t remaining = w * h;
     driver->driver_vtable->viewport(device, l, t, r, b);
+#if QUANTUM_PAINTER_ASYNC_PIXDATA
+    // The buffer is resent unmodified by subsequent calls, so it's only swapped once something else needs to write to it
+    pixdata_buffer_busy = true;
+#endif // QUANTUM_PAINTER_ASYNC_PIXDATA
     while (remaining > 0) {
         uint32_t transmit = QP_MIN(remaining, pixels_in_pixdata);
         if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, transmit)) {
@@ -251,6 +435,11 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
 }
 
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_RECT, .device = device, .x0 = left, .y0 = top, .x1 = right, .y1 = bottom, .hue_fg = hue, .sat_fg = sat, .val_fg = val, .filled = filled};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
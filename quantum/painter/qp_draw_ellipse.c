@@ -5,6 +5,7 @@
 #include "qp_internal.h"
 #include "qp_comms.h"
 #include "qp_draw.h"
+#include "qp_command_list.h"
 
 // Utilize 4-way symmetry to draw an ellipse
 static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
@@ -60,6 +61,11 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
 // Quantum Painter External API: qp_ellipse
 
 bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_ELLIPSE, .device = device, .x0 = x, .y0 = y, .x1 = sizex, .y1 = sizey, .hue_fg = hue, .sat_fg = sat, .val_fg = val, .filled = filled};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     qp_dprintf("qp_ellipse: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
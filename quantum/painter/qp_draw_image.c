@@ -4,6 +4,7 @@
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
+#include "qp_command_list.h"
 #include "qgf.h"
 #include "deferred_exec.h"
 
@@ -95,6 +96,9 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+    // Drop any palettes converted from this image, the slot may be reused by a different image
+    qp_internal_invalidate_palette_source(&qgf_image->stream);
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
@@ -125,8 +129,6 @@ typedef struct qgf_frame_info_t {
 } qgf_frame_info_t;
 
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!info) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -148,35 +150,22 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
         qp_comms_stop(device);
         return false;
     }
 
-    // Handle palette if needed
-    const uint16_t palette_entries  = 1u << info->bpp;
-    bool           needs_pixconvert = false;
+    // Handle palette if needed, converting it to native format unless already converted for this device
+    const uint16_t palette_entries = 1u << info->bpp;
     if (info->has_palette) {
         // Load the palette from the stream
-        if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
+        if (!qp_internal_load_native_qgf_palette(device, (qp_stream_t *)&qgf_image->stream, info->bpp)) {
             return false;
         }
-
-        needs_pixconvert = true;
-    } else {
-        if (info->bpp <= 8) {
-            // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-        }
-    }
-
-    if (needs_pixconvert) {
-        // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+    } else if (info->bpp <= 8) {
+        // Interpolate from fg/bg
+        if (!qp_internal_interpolate_native_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
@@ -272,12 +261,101 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
 }
 
 bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_DRAWIMAGE, .device = device, .x0 = x, .y0 = y, .hue_fg = hue_fg, .sat_fg = sat_fg, .val_fg = val_fg, .hue_bg = hue_bg, .sat_bg = sat_bg, .val_bg = val_bg, .drawimage = {.image = image}};
+        return qp_internal_command_list_record(&command, NULL, 0);
+    }
+
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter Core API: qp_internal_drawimage_recolor_rows
+
+bool qp_internal_drawimage_recolor_rows(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_drawimage_progress_t *progress, uint32_t max_pixels) {
+    qp_dprintf("qp_internal_drawimage_recolor_rows: entry (row %d)\n", (int)progress->next_row);
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (invalid image)\n");
+        return false;
+    }
+
+    // Re-read the frame info, as the palette may have been replaced since the previous band was drawn
+    qgf_frame_info_t frame_info = {0};
+    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, 0, fg_hsv888, bg_hsv888, &frame_info)) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (could not read frame 0)\n");
+        return false;
+    }
+
+    // Delta frames only cover part of the image, and LZ-compressed frames rely on a decoding window shared with every
+    // other draw, so they're drawn in one go
+    if (frame_info.is_delta || frame_info.compression_scheme == IMAGE_COMPRESSED_LZ) {
+        progress->next_row = image->height;
+        return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    }
+
+    // Bands need to start on a byte boundary within the pixel data
+    uint16_t row_step = 1;
+    while ((((uint32_t)image->width) * row_step * frame_info.bpp) % 8 != 0) {
+        ++row_step;
+    }
+
+    uint32_t rows = max_pixels / image->width;
+    rows -= rows % row_step;
+    if (rows < row_step) {
+        rows = row_step;
+    }
+    if (rows > image->height - progress->next_row) {
+        rows = image->height - progress->next_row;
+    }
+
+    // Set up the input state, resuming from the end of the previous band if there was one
+    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info.compression_scheme);
+    if (input_callback == NULL) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (invalid image compression scheme)\n");
+        return false;
+    }
+    if (progress->next_row > 0) {
+        input_state = progress->input_state;
+        qp_stream_setpos(&qgf_image->stream, progress->stream_pos);
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Configure where we're going to be rendering to
+    uint16_t t = y + progress->next_row;
+    if (!driver->driver_vtable->viewport(device, x, t, x + image->width - 1, t + rows - 1)) {
+        qp_dprintf("qp_internal_drawimage_recolor_rows: fail (could not set viewport)\n");
+        qp_comms_stop(device);
+        return false;
+    }
+
+    // Decode and stream pixels, then save off where we got to
+    bool ret = qp_internal_appender(device, frame_info.bpp, ((uint32_t)image->width) * rows, input_callback, &input_state);
+    if (ret) {
+        progress->next_row   += rows;
+        progress->stream_pos  = qp_stream_tell(&qgf_image->stream);
+        progress->input_state = input_state;
+    }
+
+    qp_dprintf("qp_internal_drawimage_recolor_rows: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_animate
 
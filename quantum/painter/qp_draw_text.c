@@ -7,6 +7,7 @@
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
+#include "qp_command_list.h"
 #include "qff.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,6 +16,7 @@
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
+    uint8_t               generation; // incremented on close, so text prepared with a previous font in this slot is rejected
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
     uint8_t               bpp;
@@ -36,6 +38,89 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+// Decoded glyph, in the native pixel format of the device it was drawn to
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if this entry is unused
+    painter_device_t   device;
+    uint32_t           code_point;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint32_t           last_used;
+    uint8_t            data[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_tick                                 = 0;
+
+typedef struct qp_glyph_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        buffer;
+    uint32_t         pixel_write_pos;
+} qp_glyph_cache_output_state_t;
+
+static inline bool qp_glyph_cache_hsv888_equal(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && qp_glyph_cache_hsv888_equal(entry->fg_hsv888, fg_hsv888) && qp_glyph_cache_hsv888_equal(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++glyph_cache_tick;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Pixel output callback which writes native pixels into a cache entry instead of the global pixdata buffer
+static bool qp_glyph_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->pixel_write_pos++, 1, &index);
+}
+
+// Decodes the glyph at the current stream position into the least recently used entry
+static qp_glyph_cache_entry_t *qp_glyph_cache_fill(qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, uint32_t pixel_count, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_byte_input_callback input_callback, qp_internal_byte_input_state_t *input_state) {
+    qp_glyph_cache_entry_t *entry = &glyph_cache[0];
+    for (int i = 1; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES && entry->font; ++i) {
+        if (!glyph_cache[i].font || glyph_cache[i].last_used < entry->last_used) {
+            entry = &glyph_cache[i];
+        }
+    }
+
+    // Invalidate while decoding, so a failure doesn't leave a partial glyph behind
+    entry->font = NULL;
+
+    qp_glyph_cache_output_state_t output_state = {.device = device, .buffer = entry->data, .pixel_write_pos = 0};
+    if (!qp_internal_decode_palette(device, pixel_count, qff_font->bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_pixel_appender, &output_state)) {
+        return NULL;
+    }
+
+    entry->font       = qff_font;
+    entry->device     = device;
+    entry->code_point = code_point;
+    entry->fg_hsv888  = fg_hsv888;
+    entry->bg_hsv888  = bg_hsv888;
+    entry->last_used  = ++glyph_cache_tick;
+    return entry;
+}
+
+static void qp_glyph_cache_invalidate_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,9 +236,18 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Drop any cached glyphs, the slot may be reused by a different font
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+    // Drop any palettes converted from this font, the slot may be reused by a different font
+    qp_internal_invalidate_palette_source(&qff_font->stream);
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
+    qff_font->generation++;
     return true;
 }
 
@@ -165,8 +259,6 @@ typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_po
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!data_offset) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -182,28 +274,20 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
         offset += sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * 6);
     }
 
-    // Handle palette if needed
-    const uint16_t palette_entries  = 1u << qff_font->bpp;
-    bool           needs_pixconvert = false;
+    // Handle palette if needed, converting it to native format unless already converted for this device
+    const uint16_t palette_entries = 1u << qff_font->bpp;
     if (qff_font->has_palette) {
         // If this font has a palette, we need to read it out and set up the pixel lookup table
         qp_stream_setpos(&qff_font->stream, offset);
-        if (!qp_internal_load_qgf_palette(&qff_font->stream, qff_font->bpp)) {
+        if (!qp_internal_load_native_qgf_palette(device, &qff_font->stream, qff_font->bpp)) {
             return false;
         }
 
         // Skip this block, as far as offset calculations go
         offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
-        needs_pixconvert = true;
     } else {
         // Interpolate from fg/bg
-        int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
-    }
-
-    if (needs_pixconvert) {
-        // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+        if (!qp_internal_interpolate_native_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
@@ -253,19 +337,27 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                      + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
                                      + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
+        // The unicode table is sorted by code point (enforced during validation), so binary search it
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        uint16_t               lower = 0;
+        uint16_t               upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t i = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, glyph_info_offset + i * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                return false;
+            }
+
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
-            if (glyph_info.code_point == code_point) {
+            if (glyph_info.code_point < code_point) {
+                lower = i + 1;
+            } else if (glyph_info.code_point > code_point) {
+                upper = i;
+            } else {
                 uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
                 uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
                 uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
@@ -316,6 +408,23 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
     return true;
 }
 
+// Function to iterate over each glyph of prepared text, invoking the callback for each glyph
+static inline bool qp_iterate_prepared_glyphs(qff_font_handle_t *qff_font, const painter_prepared_text_t *prepared, code_point_handler handler, void *cb_arg) {
+    for (uint8_t i = 0; i < prepared->num_glyphs; ++i) {
+        const painter_prepared_glyph_t *glyph = &prepared->glyphs[i];
+        if (qp_stream_setpos(&qff_font->stream, glyph->data_offset) < 0) {
+            qp_dprintf("Failed to set stream position while preparing prepared glyph data\n");
+            return false;
+        }
+
+        if (!handler(qff_font, glyph->code_point, glyph->width, qff_font->base.line_height, cb_arg)) {
+            qp_dprintf("Failed to execute glyph handler.\n");
+            return false;
+        }
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String width calculation
 
@@ -334,6 +443,49 @@ static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_f
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text preparation
+
+// Codepoint handler callback: record the glyph -- the stream is positioned at its data by qp_iterate_code_points()
+static inline bool qp_font_code_point_handler_prepare(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+    painter_prepared_text_t *prepared = (painter_prepared_text_t *)cb_arg;
+    if (prepared->num_glyphs >= QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS) {
+        qp_dprintf("Too many glyphs for prepared text, increase QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS\n");
+        return false;
+    }
+
+    painter_prepared_glyph_t *glyph = &prepared->glyphs[prepared->num_glyphs++];
+    glyph->data_offset              = qp_stream_tell(&qff_font->stream);
+    glyph->code_point               = code_point;
+    glyph->width                    = width;
+    prepared->width += width;
+    return true;
+}
+
+// Checks whether the prepared text was created with a font which is still open
+static bool qp_prepared_text_valid(const painter_prepared_text_t *prepared) {
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)prepared->font;
+    return qff_font && qff_font->validate_ok && qff_font->generation == prepared->font_generation;
+}
+
+// Checks whether the prepared text was created from the supplied string, without touching the font
+static bool qp_prepared_text_matches(const painter_prepared_text_t *prepared, painter_font_handle_t font, const char *str) {
+    if (prepared->font != font || !qp_prepared_text_valid(prepared)) {
+        return false;
+    }
+
+    uint8_t i = 0;
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (i >= prepared->num_glyphs || code_point < 0 || prepared->glyphs[i].code_point != (uint32_t)code_point) {
+            return false;
+        }
+        ++i;
+    }
+    return i == prepared->num_glyphs;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String drawing implementation
 
@@ -345,6 +497,8 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
@@ -364,41 +518,31 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_textwidth
 
-int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
-    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
-    if (!qff_font || !qff_font->validate_ok) {
-        qp_dprintf("qp_textwidth: fail (invalid font)\n");
-        return false;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Palette-based glyphs small enough to cache are sent straight from the cache, decoding them first if needed
+    if (qff_font->bpp <= 8 && ((pixel_count * driver->native_bits_per_pixel + 7) / 8) <= QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+        qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888);
+        if (!entry) {
+            entry = qp_glyph_cache_fill(qff_font, state->device, code_point, pixel_count, state->fg_hsv888, state->bg_hsv888, state->input_callback, state->input_state);
+            if (!entry) {
+                return false;
+            }
+        }
+        return driver->driver_vtable->pixdata(state->device, entry->data, pixel_count);
     }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
-    // Create the codepoint iterator state
-    code_point_iter_calcwidth_state_t state = {.width = 0};
-    // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
-}
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_drawtext
-
-int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str) {
-    // Offload to the recolor variant, substituting fg=white bg=black.
-    // Traditional LCDs with those colors will need to manually invoke qp_drawtext_recolor with the colors reversed.
-    return qp_drawtext_recolor(device, x, y, font, str, 0, 0, 255, 0, 0, 0);
+    // Decode the pixel data for the glyph, and stream it
+    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Quantum Painter External API: qp_drawtext_recolor
+// String drawing: common implementation
 
-int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
-    qp_dprintf("qp_drawtext_recolor: entry\n");
+// Draws either a string or prepared text, whichever is supplied
+static int16_t qp_drawtext_internal(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, const painter_prepared_text_t *prepared, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
         qp_dprintf("qp_drawtext_recolor: fail (validation_ok == false)\n");
@@ -441,7 +585,9 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+    state.fg_hsv888      = fg_hsv888;
+    state.bg_hsv888      = bg_hsv888;
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -449,9 +595,110 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     }
 
     // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    bool ret = prepared ? qp_iterate_prepared_glyphs(qff_font, prepared, qp_font_code_point_handler_drawglyph, &state) : qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_textwidth
+
+int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_textwidth: fail (invalid font)\n");
+        return false;
+    }
+
+    // Create the codepoint iterator state
+    code_point_iter_calcwidth_state_t state = {.width = 0};
+    // Iterate each codepoint, return the calculated width if successful.
+    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext
+
+int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str) {
+    // Offload to the recolor variant, substituting fg=white bg=black.
+    // Traditional LCDs with those colors will need to manually invoke qp_drawtext_recolor with the colors reversed.
+    return qp_drawtext_recolor(device, x, y, font, str, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_recolor
+
+int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_drawtext_recolor: entry\n");
+    if (qp_internal_command_list_recording()) {
+        qp_command_t command = {.type = QP_COMMAND_DRAWTEXT, .device = device, .x0 = x, .y0 = y, .hue_fg = hue_fg, .sat_fg = sat_fg, .val_fg = val_fg, .hue_bg = hue_bg, .sat_bg = sat_bg, .val_bg = val_bg, .drawtext = {.font = font}};
+        return qp_internal_command_list_record(&command, str, strlen(str) + 1) ? qp_textwidth(font, str) : 0;
+    }
+
+    return qp_drawtext_internal(device, x, y, font, str, NULL, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_prepare_text
+
+bool qp_prepare_text(painter_prepared_text_t *prepared, painter_font_handle_t font, const char *str) {
+    prepared->font       = NULL;
+    prepared->width      = 0;
+    prepared->num_glyphs = 0;
+
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_prepare_text: fail (invalid font)\n");
+        return false;
+    }
+
+    if (!qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_prepare, prepared)) {
+        qp_dprintf("qp_prepare_text: fail (could not prepare glyphs)\n");
+        prepared->width      = 0;
+        prepared->num_glyphs = 0;
+        return false;
+    }
+
+    prepared->font            = font;
+    prepared->font_generation = qff_font->generation;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_prepare_text_if_changed
+
+bool qp_prepare_text_if_changed(painter_prepared_text_t *prepared, painter_font_handle_t font, const char *str) {
+    if (qp_prepared_text_matches(prepared, font, str)) {
+        return false;
+    }
+
+    return qp_prepare_text(prepared, font, str);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_prepared
+
+int16_t qp_drawtext_prepared(painter_device_t device, uint16_t x, uint16_t y, const painter_prepared_text_t *prepared) {
+    // Offload to the recolor variant, substituting fg=white bg=black, same as qp_drawtext.
+    return qp_drawtext_prepared_recolor(device, x, y, prepared, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_prepared_recolor
+
+int16_t qp_drawtext_prepared_recolor(painter_device_t device, uint16_t x, uint16_t y, const painter_prepared_text_t *prepared, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_drawtext_prepared_recolor: entry\n");
+    if (!prepared || !qp_prepared_text_valid(prepared)) {
+        qp_dprintf("qp_drawtext_prepared_recolor: fail (invalid prepared text)\n");
+        return 0;
+    }
+
+    if (qp_internal_command_list_recording()) {
+        // The prepared text is copied into the command list, as the caller's copy may be re-prepared before it is drawn
+        qp_command_t command = {.type = QP_COMMAND_DRAWTEXT_PREPARED, .device = device, .x0 = x, .y0 = y, .hue_fg = hue_fg, .sat_fg = sat_fg, .val_fg = val_fg, .hue_bg = hue_bg, .sat_bg = sat_bg, .val_bg = val_bg};
+        return qp_internal_command_list_record(&command, prepared, offsetof(painter_prepared_text_t, glyphs) + prepared->num_glyphs * sizeof(painter_prepared_glyph_t)) ? prepared->width : 0;
+    }
+    return qp_drawtext_internal(device, x, y, prepared->font, NULL, prepared, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+}
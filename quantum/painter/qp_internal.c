@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_internal.h"
+#include "qp_command_list.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: device registration
@@ -20,7 +21,7 @@ enum {
                      + (SH1106_NUM_DEVICES)  // SH1106
 };
 
-static painter_device_t qp_devices[QP_NUM_DEVICES] = {NULL};
+static painter_device_t qp_devices[QP_NUM_DEVICES];
 
 bool qp_internal_register_device(painter_device_t driver) {
     for (uint8_t i = 0; i < QP_NUM_DEVICES; i++) {
@@ -89,6 +90,11 @@ void qp_internal_task(void) {
     qp_lvgl_internal_tick();
 #endif
 
+#if (QUANTUM_PAINTER_COMMAND_LIST_SIZE) > 0
+    // Execute any deferred draw calls
+    qp_internal_command_list_task();
+#endif // (QUANTUM_PAINTER_COMMAND_LIST_SIZE) > 0
+
     // Flush (render) dirty regions to corresponding displays
 #if !defined(QUANTUM_PAINTER_DEBUG_ENABLE_FLUSH_TASK_OUTPUT)
     bool old_debug_state = debug_enable;
@@ -0,0 +1,236 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "fnv.h"
+#include "qp_benchmark_assets.h"
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark harness
+//
+// Each benchmark draws into a surface (aka framebuffer) using the dummy comms driver, so that only the core rendering, decoding
+// and pixel conversion paths are measured. The surface's vtable is wrapped so that every native pixel handed to the driver is
+// counted, which allows the throughput to be reported in both pixels and bytes per second. Once the benchmark completes, the
+// contents of the framebuffer are hashed and compared against a known-good value, so that any optimisation to the rendering
+// paths which changes their output is caught.
+//
+// Throughput is only printed if QP_BENCHMARK_OUTPUT is defined, so that normal test runs stay quiet -- the figures are still
+// recorded as test properties, and can be retrieved with --gtest_output=xml.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QP_BENCHMARK_ITERATIONS
+#    define QP_BENCHMARK_ITERATIONS 100
+#endif // QP_BENCHMARK_ITERATIONS
+
+#define RGB565_WIDTH 240
+#define RGB565_HEIGHT 320
+#define MONO_WIDTH 128
+#define MONO_HEIGHT 64
+
+static uint8_t rgb565_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(RGB565_WIDTH, RGB565_HEIGHT, 16)];
+static uint8_t rgb565_source_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(RGB565_WIDTH / 2, RGB565_HEIGHT / 2, 16)];
+static uint8_t mono_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(MONO_WIDTH, MONO_HEIGHT, 1)];
+
+static surface_painter_device_t        benchmark_devices[3];
+static surface_painter_driver_vtable_t counting_vtables[2];
+static const painter_driver_vtable_t  *original_vtables[2];
+static uint64_t                        native_pixels_written;
+
+template <size_t N>
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    native_pixels_written += native_pixel_count;
+    return original_vtables[N]->pixdata(device, pixel_data, native_pixel_count);
+}
+
+template <size_t N>
+static painter_device_t wrap_device(painter_device_t device) {
+    painter_driver_t *driver         = (painter_driver_t *)device;
+    original_vtables[N]              = driver->driver_vtable;
+    counting_vtables[N]              = *(const surface_painter_driver_vtable_t *)driver->driver_vtable;
+    counting_vtables[N].base.pixdata = counting_pixdata<N>;
+    driver->driver_vtable            = (painter_driver_vtable_t *)&counting_vtables[N];
+    return device;
+}
+
+class QuantumPainterBenchmark : public ::testing::Test {
+   protected:
+    painter_device_t rgb565;
+    painter_device_t rgb565_source;
+    painter_device_t mono;
+
+    void SetUp() override {
+        memset(benchmark_devices, 0, sizeof(benchmark_devices));
+        memset(rgb565_framebuffer, 0, sizeof(rgb565_framebuffer));
+        memset(rgb565_source_framebuffer, 0, sizeof(rgb565_source_framebuffer));
+        memset(mono_framebuffer, 0, sizeof(mono_framebuffer));
+
+        rgb565 = wrap_device<0>(qp_make_rgb565_surface_advanced(benchmark_devices, 3, RGB565_WIDTH, RGB565_HEIGHT, rgb565_framebuffer));
+        mono   = wrap_device<1>(qp_make_mono1bpp_surface_advanced(benchmark_devices, 3, MONO_WIDTH, MONO_HEIGHT, mono_framebuffer));
+
+        // The source surface is deliberately left unwrapped, so only pixels arriving at the target are counted
+        rgb565_source = qp_make_rgb565_surface_advanced(benchmark_devices, 3, RGB565_WIDTH / 2, RGB565_HEIGHT / 2, rgb565_source_framebuffer);
+
+        ASSERT_TRUE(qp_init(rgb565, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(rgb565_source, QP_ROTATION_0));
+    }
+
+    template <typename F>
+    void benchmark(const char *name, painter_device_t device, F &&draw) {
+        native_pixels_written = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < QP_BENCHMARK_ITERATIONS; ++i) {
+            ASSERT_TRUE(draw(i)) << name << " failed on iteration " << i;
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        painter_driver_t *driver = (painter_driver_t *)device;
+        uint64_t          bytes  = (native_pixels_written * driver->native_bits_per_pixel) / 8;
+        double            mpx_s  = elapsed > 0 ? (native_pixels_written / elapsed) / 1e6 : 0;
+        double            mb_s   = elapsed > 0 ? (bytes / elapsed) / 1e6 : 0;
+#ifdef QP_BENCHMARK_OUTPUT
+        printf("[   BENCH  ] %-24s %12llu px %10.2f Mpx/s %10.2f MB/s\n", name, (unsigned long long)native_pixels_written, mpx_s, mb_s);
+#endif // QP_BENCHMARK_OUTPUT
+        RecordProperty("pixels", std::to_string(native_pixels_written));
+        RecordProperty("mpixels_per_second", std::to_string(mpx_s));
+        RecordProperty("mbytes_per_second", std::to_string(mb_s));
+    }
+
+    static uint32_t framebuffer_hash(uint8_t *buffer, size_t length) {
+        return fnv_32a_buf(buffer, length, FNV1_32A_INIT);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Primitives
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(QuantumPainterBenchmark, FilledRectRGB565) {
+    benchmark("qp_rect/rgb565", rgb565, [&](uint32_t i) { return qp_rect(rgb565, (i * 7) % 40, (i * 11) % 60, 199 + (i % 40), 259 + (i % 60), i * 13, 255, 255, true); });
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 2342855195u);
+}
+
+TEST_F(QuantumPainterBenchmark, FilledRectMono) {
+    benchmark("qp_rect/mono1bpp", mono, [&](uint32_t i) { return qp_rect(mono, (i * 7) % 32, (i * 3) % 16, 95 + (i % 32), 47 + (i % 16), 0, 0, (i & 1) ? 255 : 0, true); });
+    EXPECT_EQ(framebuffer_hash(mono_framebuffer, sizeof(mono_framebuffer)), 3300294456u);
+}
+
+TEST_F(QuantumPainterBenchmark, Line) {
+    benchmark("qp_line/rgb565", rgb565, [&](uint32_t i) { return qp_line(rgb565, 0, (i * 3) % RGB565_HEIGHT, RGB565_WIDTH - 1, RGB565_HEIGHT - 1 - ((i * 3) % RGB565_HEIGHT), i * 13, 255, 255); });
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 354046485u);
+}
+
+TEST_F(QuantumPainterBenchmark, Circle) {
+    benchmark("qp_circle/rgb565", rgb565, [&](uint32_t i) { return qp_circle(rgb565, RGB565_WIDTH / 2, RGB565_HEIGHT / 2, 100 - (i % 100), i * 13, 255, 255, false); });
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 2459606821u);
+}
+
+TEST_F(QuantumPainterBenchmark, FilledCircle) {
+    benchmark("qp_circle/rgb565/filled", rgb565, [&](uint32_t i) { return qp_circle(rgb565, RGB565_WIDTH / 2, RGB565_HEIGHT / 2, 100 - (i % 100), i * 13, 255, 255, true); });
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 3867997412u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Images
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ImageBenchmarkParam {
+    const char    *name;
+    const uint8_t *data;
+    bool           recolor;
+    uint32_t       expected_hash;
+};
+
+static std::ostream &operator<<(std::ostream &os, const ImageBenchmarkParam &param) {
+    return os << param.name;
+}
+
+class QuantumPainterImageBenchmark : public QuantumPainterBenchmark, public ::testing::WithParamInterface<ImageBenchmarkParam> {};
+
+TEST_P(QuantumPainterImageBenchmark, DrawImage) {
+    auto                   param = GetParam();
+    painter_image_handle_t image = qp_load_image_mem(param.data);
+    ASSERT_NE(image, nullptr);
+
+    // Tile the image across the display, recoloring the monochrome formats on each iteration
+    uint16_t columns = RGB565_WIDTH / image->width;
+    uint16_t rows    = RGB565_HEIGHT / image->height;
+    benchmark(param.name, rgb565, [&](uint32_t i) {
+        uint16_t x = (i % columns) * image->width;
+        uint16_t y = ((i / columns) % rows) * image->height;
+        if (param.recolor) {
+            return qp_drawimage_recolor(rgb565, x, y, image, i * 13, 255, 255, (i * 13) + 128, 255, 64);
+        }
+        return qp_drawimage(rgb565, x, y, image);
+    });
+
+    EXPECT_TRUE(qp_close_image(image));
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), param.expected_hash);
+}
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(
+    Formats,
+    QuantumPainterImageBenchmark,
+    ::testing::Values(
+        ImageBenchmarkParam{"qp_drawimage/mono2",      gfx_bench_mono2_raw,   true,  1498606941u},
+        ImageBenchmarkParam{"qp_drawimage/mono2/rle",  gfx_bench_mono2_rle,   true,  1498606941u},
+        ImageBenchmarkParam{"qp_drawimage/mono4",      gfx_bench_mono4_raw,   true,  4189151121u},
+        ImageBenchmarkParam{"qp_drawimage/mono4/rle",  gfx_bench_mono4_rle,   true,  4189151121u},
+        ImageBenchmarkParam{"qp_drawimage/pal16",      gfx_bench_pal16_raw,   false, 3496290837u},
+        ImageBenchmarkParam{"qp_drawimage/pal16/rle",  gfx_bench_pal16_rle,   false, 3496290837u},
+        ImageBenchmarkParam{"qp_drawimage/pal256",     gfx_bench_pal256_raw,  false, 1450429557u},
+        ImageBenchmarkParam{"qp_drawimage/pal256/rle", gfx_bench_pal256_rle,  false, 1450429557u},
+        ImageBenchmarkParam{"qp_drawimage/rgb565",     gfx_bench_rgb565_raw,  false, 3104295349u},
+        ImageBenchmarkParam{"qp_drawimage/rgb565/rle", gfx_bench_rgb565_rle,  false, 3104295349u}
+    ),
+    [](const ::testing::TestParamInfo<ImageBenchmarkParam> &info) {
+        std::string name = info.param.name + strlen("qp_drawimage/");
+        for (auto &c : name) {
+            if (c == '/') c = '_';
+        }
+        return name;
+    }
+);
+// clang-format on
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(QuantumPainterBenchmark, DrawText) {
+    painter_font_handle_t font = qp_load_font_mem(font_bench);
+    ASSERT_NE(font, nullptr);
+
+    uint16_t rows = RGB565_HEIGHT / font->line_height;
+    benchmark("qp_drawtext/mono4", rgb565, [&](uint32_t i) {
+        uint16_t y = (i % rows) * font->line_height;
+        return qp_drawtext_recolor(rgb565, (i * 5) % 16, y, font, "The quick brown fox jumps over", i * 13, 255, 255, 0, 0, 0) > 0;
+    });
+
+    EXPECT_TRUE(qp_close_font(font));
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 2960597065u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Surfaces
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(QuantumPainterBenchmark, SurfaceDraw) {
+    benchmark("qp_surface_draw/rgb565", rgb565, [&](uint32_t i) {
+        // Touch the source surface so it has something to transfer, then copy the whole surface to a quadrant of the target
+        if (!qp_rect(rgb565_source, (i * 7) % 100, (i * 11) % 140, 19 + ((i * 7) % 100), 19 + ((i * 11) % 140), i * 13, 255, 255, true)) {
+            return false;
+        }
+        return qp_surface_draw(rgb565_source, rgb565, (i % 2) * (RGB565_WIDTH / 2), ((i / 2) % 2) * (RGB565_HEIGHT / 2), true);
+    });
+    EXPECT_EQ(framebuffer_hash(rgb565_framebuffer, sizeof(rgb565_framebuffer)), 588907258u);
+}
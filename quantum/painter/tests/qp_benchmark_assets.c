@@ -0,0 +1,710 @@
+// Copyright 2024 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Test assets for the Quantum Painter benchmark, generated from a 32x32 test pattern using `qmk painter-convert-graphics`
+// with each format (`--no-rle` for the raw variants, `--no-lz` for all), and from Source Code Pro Regular at 12px
+// (SIL Open Font License) using `qmk painter-make-font-image` and `qmk painter-convert-font-image -f mono4`.
+
+#include <qp.h>
+#include "qp_benchmark_assets.h"
+
+const uint32_t gfx_bench_mono2_raw_length = 176;
+
+// clang-format off
+const uint8_t gfx_bench_mono2_raw[176] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x80, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x7E, 0x00, 0x00, 0x20, 0xFF, 0x00, 0x00,
+    0xC0, 0xFF, 0xC3, 0x3F, 0xC0, 0xFF, 0xC3, 0x3F, 0xE0, 0xFF, 0xC7, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F,
+    0xF0, 0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F,
+    0xF0, 0xFF, 0xDF, 0x3F, 0xE0, 0xFF, 0xE7, 0x3F, 0xC0, 0xFF, 0xC3, 0x3F, 0xC0, 0xFF, 0xC3, 0x3F,
+    0x00, 0xFF, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x80,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
+
+const uint32_t gfx_bench_mono2_rle_length = 149;
+
+// clang-format off
+const uint8_t gfx_bench_mono2_rle[149] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x95, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x65, 0x00, 0x00,
+    0x80, 0x01, 0x03, 0x00, 0x80, 0x06, 0x03, 0x00, 0x81, 0x18, 0x7E, 0x02, 0x00, 0x81, 0x20, 0xFF,
+    0x02, 0x00, 0xB7, 0xC0, 0xFF, 0xC3, 0x3F, 0xC0, 0xFF, 0xC3, 0x3F, 0xE0, 0xFF, 0xC7, 0x3F, 0xF0,
+    0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xCF, 0x3F, 0xF0,
+    0xFF, 0xCF, 0x3F, 0xF0, 0xFF, 0xDF, 0x3F, 0xE0, 0xFF, 0xE7, 0x3F, 0xC0, 0xFF, 0xC3, 0x3F, 0xC0,
+    0xFF, 0xC3, 0x3F, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x18, 0x03, 0x00, 0x80, 0x60, 0x03,
+    0x00, 0x80, 0x80, 0x02, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x02,
+    0xFF, 0x02, 0x00, 0x20, 0xFF,
+};
+// clang-format on
+
+const uint32_t gfx_bench_mono4_raw_length = 304;
+
+// clang-format off
+const uint8_t gfx_bench_mono4_raw[304] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x30, 0x01, 0x00, 0x00, 0xCF, 0xFE, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x03, 0xA8, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0x0A, 0x00, 0xA0, 0xAB, 0xAA, 0x0A, 0xA0, 0xAA, 0x0A,
+    0x00, 0xA8, 0xBE, 0xAA, 0x2A, 0xA0, 0xAA, 0x0A, 0x00, 0xAA, 0xEA, 0xAB, 0xAA, 0xA0, 0xAA, 0x0A,
+    0x00, 0xAA, 0xAA, 0xAE, 0xAA, 0xA0, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xFA, 0xAA, 0xA0, 0xAA, 0x0A,
+    0x00, 0xAA, 0xAA, 0xAA, 0xAF, 0xA0, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xBA, 0xA0, 0xAA, 0x0A,
+    0x00, 0xAA, 0xAA, 0xAA, 0xEA, 0xA3, 0xAA, 0x0A, 0x00, 0xA8, 0xAA, 0xAA, 0x2A, 0xBC, 0xAA, 0x0A,
+    0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0xE0, 0xAA, 0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0xA0, 0xAF, 0x0A,
+    0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xC0, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
+
+const uint32_t gfx_bench_mono4_rle_length = 215;
+
+// clang-format off
+const uint8_t gfx_bench_mono4_rle[215] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xD7, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xA7, 0x00, 0x00,
+    0x80, 0x03, 0x07, 0x00, 0x80, 0x3C, 0x07, 0x00, 0x83, 0xC0, 0x03, 0xA8, 0x2A, 0x05, 0x00, 0x80,
+    0x0C, 0x02, 0xAA, 0x05, 0x00, 0x80, 0xF0, 0x02, 0xAA, 0x9C, 0x0A, 0xA0, 0xAA, 0x0A, 0x00, 0xA0,
+    0xAB, 0xAA, 0x0A, 0xA0, 0xAA, 0x0A, 0x00, 0xA8, 0xBE, 0xAA, 0x2A, 0xA0, 0xAA, 0x0A, 0x00, 0xAA,
+    0xEA, 0xAB, 0xAA, 0xA0, 0xAA, 0x0A, 0x00, 0x02, 0xAA, 0x85, 0xAE, 0xAA, 0xA0, 0xAA, 0x0A, 0x00,
+    0x02, 0xAA, 0x85, 0xFA, 0xAA, 0xA0, 0xAA, 0x0A, 0x00, 0x03, 0xAA, 0x84, 0xAF, 0xA0, 0xAA, 0x0A,
+    0x00, 0x03, 0xAA, 0x84, 0xBA, 0xA0, 0xAA, 0x0A, 0x00, 0x03, 0xAA, 0x85, 0xEA, 0xA3, 0xAA, 0x0A,
+    0x00, 0xA8, 0x02, 0xAA, 0x85, 0x2A, 0xBC, 0xAA, 0x0A, 0x00, 0xA0, 0x02, 0xAA, 0x85, 0x0A, 0xE0,
+    0xAA, 0x0A, 0x00, 0xA0, 0x02, 0xAA, 0x83, 0x0A, 0xA0, 0xAF, 0x0A, 0x02, 0x00, 0x02, 0xAA, 0x02,
+    0x00, 0x80, 0x30, 0x03, 0x00, 0x81, 0xA8, 0x2A, 0x02, 0x00, 0x81, 0xC0, 0x03, 0x07, 0x00, 0x80,
+    0x3C, 0x07, 0x00, 0x80, 0xC0, 0x04, 0xAA, 0x04, 0x55, 0x04, 0xAA, 0x04, 0x55, 0x04, 0xAA, 0x04,
+    0x55, 0x04, 0xAA, 0x04, 0x55, 0x40, 0xFF,
+};
+// clang-format on
+
+const uint32_t gfx_bench_pal16_raw_length = 613;
+
+// clang-format off
+const uint8_t gfx_bench_pal16_raw[613] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x65, 0x02, 0x00, 0x00, 0x9A, 0xFD, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x21, 0xFF, 0xFF, 0x6A, 0xF2, 0xF3, 0x6A, 0xD5, 0xDB, 0x6A, 0xB0, 0xC3, 0x8B,
+    0xFF, 0xFF, 0x6A, 0x6F, 0xA3, 0x6B, 0x1C, 0x87, 0xE9, 0x3A, 0x90, 0xE9, 0x71, 0xA4, 0xE9, 0x9C,
+    0xB8, 0xE9, 0xB8, 0xC8, 0xE9, 0xCB, 0xD4, 0xE9, 0xE5, 0xE8, 0xE9, 0xF7, 0xF8, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0x00, 0x02, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x01, 0x10, 0x11, 0x11, 0x11, 0xF1, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x01, 0x10, 0x11, 0x11, 0x11, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0xFF,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0xF0,
+    0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xF1, 0x0F,
+    0x50, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF,
+    0x05, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF,
+    0x55, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x11, 0x11, 0xF1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x22, 0x22, 0x33, 0x44, 0x44, 0x66, 0x66, 0x77, 0x87, 0x88, 0x99,
+    0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x22, 0x22, 0x33, 0x44, 0x44, 0x66, 0x66, 0x77, 0x87, 0x88, 0x99,
+    0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x22, 0x22, 0x33, 0x44, 0x44, 0x66, 0x66, 0x77, 0x87, 0x88, 0x99,
+    0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x22, 0x22, 0x33, 0x44, 0x44, 0x66, 0x66, 0x77, 0x87, 0x88, 0x99,
+    0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+// clang-format on
+
+const uint32_t gfx_bench_pal16_rle_length = 365;
+
+// clang-format off
+const uint8_t gfx_bench_pal16_rle[365] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x6D, 0x01, 0x00, 0x00, 0x92, 0xFE, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x06, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x21, 0xFF, 0xFF, 0x6A, 0xF2, 0xF3, 0x6A, 0xD5, 0xDB, 0x6A, 0xB0, 0xC3, 0x8B,
+    0xFF, 0xFF, 0x6A, 0x6F, 0xA3, 0x6B, 0x1C, 0x87, 0xE9, 0x3A, 0x90, 0xE9, 0x71, 0xA4, 0xE9, 0x9C,
+    0xB8, 0xE9, 0xB8, 0xC8, 0xE9, 0xCB, 0xD4, 0xE9, 0xE5, 0xE8, 0xE9, 0xF7, 0xF8, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0x08, 0x01, 0x00, 0x80, 0xF0, 0x0F, 0xFF, 0x81, 0x0F, 0xF0, 0x0F, 0xFF, 0x83, 0x0F,
+    0xF0, 0xFF, 0x1F, 0x02, 0x11, 0x80, 0xF1, 0x0A, 0xFF, 0x81, 0x0F, 0xFF, 0x04, 0x11, 0x0B, 0xFF,
+    0x80, 0x00, 0x05, 0x11, 0x02, 0xFF, 0x04, 0x55, 0x04, 0xFF, 0x81, 0x11, 0x10, 0x04, 0x11, 0x02,
+    0xFF, 0x04, 0x55, 0x03, 0xFF, 0x83, 0x1F, 0x11, 0x01, 0x10, 0x03, 0x11, 0x81, 0xF1, 0xFF, 0x04,
+    0x55, 0x03, 0xFF, 0x03, 0x11, 0x81, 0x01, 0x10, 0x03, 0x11, 0x80, 0xFF, 0x04, 0x55, 0x03, 0xFF,
+    0x04, 0x11, 0x80, 0x01, 0x03, 0x11, 0x80, 0xFF, 0x04, 0x55, 0x03, 0xFF, 0x05, 0x11, 0x80, 0x00,
+    0x02, 0x11, 0x80, 0xFF, 0x04, 0x55, 0x03, 0xFF, 0x06, 0x11, 0x82, 0x00, 0x11, 0xFF, 0x04, 0x55,
+    0x03, 0xFF, 0x07, 0x11, 0x81, 0x10, 0xFF, 0x04, 0x55, 0x03, 0xFF, 0x07, 0x11, 0x81, 0x01, 0xF0,
+    0x04, 0x55, 0x03, 0xFF, 0x80, 0x1F, 0x06, 0x11, 0x82, 0xF1, 0x0F, 0x50, 0x03, 0x55, 0x04, 0xFF,
+    0x06, 0x11, 0x02, 0xFF, 0x80, 0x05, 0x03, 0x55, 0x04, 0xFF, 0x06, 0x11, 0x02, 0xFF, 0x81, 0x55,
+    0x00, 0x02, 0x55, 0x05, 0xFF, 0x04, 0x11, 0x05, 0xFF, 0x80, 0xF0, 0x06, 0xFF, 0x80, 0x1F, 0x02,
+    0x11, 0x80, 0xF1, 0x05, 0xFF, 0x81, 0x0F, 0xF0, 0x0F, 0xFF, 0x81, 0x0F, 0xF0, 0x0F, 0xFF, 0x80,
+    0x0F, 0x02, 0x22, 0x80, 0x33, 0x02, 0x44, 0x02, 0x66, 0x88, 0x77, 0x87, 0x88, 0x99, 0xAA, 0xBA,
+    0xCC, 0xDD, 0xED, 0x02, 0x22, 0x80, 0x33, 0x02, 0x44, 0x02, 0x66, 0x88, 0x77, 0x87, 0x88, 0x99,
+    0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x02, 0x22, 0x80, 0x33, 0x02, 0x44, 0x02, 0x66, 0x88, 0x77, 0x87,
+    0x88, 0x99, 0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x02, 0x22, 0x80, 0x33, 0x02, 0x44, 0x02, 0x66, 0x88,
+    0x77, 0x87, 0x88, 0x99, 0xAA, 0xBA, 0xCC, 0xDD, 0xED, 0x7F, 0x00, 0x80, 0x00,
+};
+// clang-format on
+
+const uint32_t gfx_bench_pal256_raw_length = 1845;
+
+// clang-format off
+const uint8_t gfx_bench_pal256_raw[1845] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x35, 0x07, 0x00, 0x00, 0xCA, 0xF8, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFF, 0x21, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0x6A, 0xF6, 0xF7, 0x6A, 0xED, 0xEF, 0x6A,
+    0xE4, 0xE7, 0x6A, 0xDA, 0xDF, 0x6A, 0xCF, 0xD7, 0x6A, 0xC3, 0xCF, 0x6A, 0xB7, 0xC7, 0x6A, 0xA9,
+    0xBF, 0x6A, 0x9A, 0xB7, 0x8B, 0xFF, 0xFF, 0x6A, 0x8A, 0xAF, 0x6A, 0x78, 0xA7, 0x6A, 0x65, 0x9F,
+    0x6A, 0x4F, 0x97, 0x6A, 0x37, 0x8F, 0x6B, 0x1C, 0x87, 0xD4, 0x01, 0x80, 0xE8, 0x1F, 0x88, 0xE9,
+    0x3A, 0x90, 0xE9, 0x52, 0x98, 0xE9, 0x67, 0xA0, 0xE9, 0x7A, 0xA8, 0xE9, 0x8C, 0xB0, 0xE9, 0x9C,
+    0xB8, 0xE9, 0xAB, 0xC0, 0xE9, 0xB8, 0xC8, 0xE9, 0xC5, 0xD0, 0xE9, 0xD0, 0xD8, 0xE9, 0xDB, 0xE0,
+    0xE9, 0xE5, 0xE8, 0xE9, 0xEF, 0xF0, 0xE9, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0x00, 0x04, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x00, 0x23, 0x23, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x23, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x23, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x0C, 0x00, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x0C, 0x0C, 0x00, 0x00, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x00,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x00, 0x00, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+// clang-format on
+
+const uint32_t gfx_bench_pal256_rle_length = 1138;
+
+// clang-format off
+const uint8_t gfx_bench_pal256_rle[1138] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x72, 0x04, 0x00, 0x00, 0x8D, 0xFB, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFF, 0x21, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0x6A, 0xF6, 0xF7, 0x6A, 0xED, 0xEF, 0x6A,
+    0xE4, 0xE7, 0x6A, 0xDA, 0xDF, 0x6A, 0xCF, 0xD7, 0x6A, 0xC3, 0xCF, 0x6A, 0xB7, 0xC7, 0x6A, 0xA9,
+    0xBF, 0x6A, 0x9A, 0xB7, 0x8B, 0xFF, 0xFF, 0x6A, 0x8A, 0xAF, 0x6A, 0x78, 0xA7, 0x6A, 0x65, 0x9F,
+    0x6A, 0x4F, 0x97, 0x6A, 0x37, 0x8F, 0x6B, 0x1C, 0x87, 0xD4, 0x01, 0x80, 0xE8, 0x1F, 0x88, 0xE9,
+    0x3A, 0x90, 0xE9, 0x52, 0x98, 0xE9, 0x67, 0xA0, 0xE9, 0x7A, 0xA8, 0xE9, 0x8C, 0xB0, 0xE9, 0x9C,
+    0xB8, 0xE9, 0xAB, 0xC0, 0xE9, 0xB8, 0xC8, 0xE9, 0xC5, 0xD0, 0xE9, 0xD0, 0xD8, 0xE9, 0xDB, 0xE0,
+    0xE9, 0xE5, 0xE8, 0xE9, 0xEF, 0xF0, 0xE9, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFA, 0x3D, 0x01, 0x00, 0x80, 0x00, 0x20, 0x23, 0x02, 0x00, 0x20, 0x23, 0x02, 0x00, 0x04,
+    0x23, 0x06, 0x01, 0x16, 0x23, 0x80, 0x00, 0x02, 0x23, 0x08, 0x01, 0x16, 0x23, 0x02, 0x00, 0x0A,
+    0x01, 0x04, 0x23, 0x08, 0x0C, 0x08, 0x23, 0x02, 0x01, 0x80, 0x00, 0x09, 0x01, 0x04, 0x23, 0x08,
+    0x0C, 0x07, 0x23, 0x04, 0x01, 0x02, 0x00, 0x08, 0x01, 0x03, 0x23, 0x08, 0x0C, 0x06, 0x23, 0x07,
+    0x01, 0x02, 0x00, 0x07, 0x01, 0x02, 0x23, 0x08, 0x0C, 0x06, 0x23, 0x09, 0x01, 0x80, 0x00, 0x06,
+    0x01, 0x02, 0x23, 0x08, 0x0C, 0x06, 0x23, 0x0A, 0x01, 0x02, 0x00, 0x04, 0x01, 0x02, 0x23, 0x08,
+    0x0C, 0x06, 0x23, 0x0C, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x23, 0x08, 0x0C, 0x06, 0x23, 0x0E,
+    0x01, 0x81, 0x00, 0x01, 0x02, 0x23, 0x08, 0x0C, 0x06, 0x23, 0x0F, 0x01, 0x02, 0x00, 0x80, 0x23,
+    0x08, 0x0C, 0x07, 0x23, 0x0E, 0x01, 0x02, 0x23, 0x02, 0x00, 0x07, 0x0C, 0x08, 0x23, 0x0C, 0x01,
+    0x04, 0x23, 0x81, 0x0C, 0x00, 0x06, 0x0C, 0x08, 0x23, 0x0C, 0x01, 0x04, 0x23, 0x02, 0x0C, 0x02,
+    0x00, 0x04, 0x0C, 0x0A, 0x23, 0x08, 0x01, 0x0A, 0x23, 0x80, 0x00, 0x0E, 0x23, 0x06, 0x01, 0x0C,
+    0x23, 0x02, 0x00, 0x20, 0x23, 0x02, 0x00, 0x20, 0x23, 0xFF, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x80, 0x22, 0x7F, 0x00, 0x7F, 0x00,
+    0x02, 0x00,
+};
+// clang-format on
+
+const uint32_t gfx_bench_rgb565_raw_length = 2096;
+
+// clang-format off
+const uint8_t gfx_bench_rgb565_raw[2096] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x30, 0x08, 0x00, 0x00, 0xCF, 0xF7, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x00, 0x08, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40,
+    0xFF, 0xFF, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFF, 0xFF, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF, 0xFF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x05, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+// clang-format on
+
+const uint32_t gfx_bench_rgb565_rle_length = 1019;
+
+// clang-format off
+const uint8_t gfx_bench_rgb565_rle[1019] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xFB, 0x03, 0x00, 0x00, 0x04, 0xFC, 0xFF,
+    0xFF, 0x20, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x08, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0xCB, 0x03, 0x00,
+    0x02, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0x08, 0x00, 0x8B, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x2C, 0x00, 0x02, 0xFF, 0x04, 0x00, 0x8F,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0x2C, 0x00, 0x04, 0xFF, 0x93, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x08, 0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x10, 0x00, 0x83, 0xFE,
+    0x40, 0xFE, 0x40, 0x02, 0xFF, 0x91, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x08, 0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF, 0x05,
+    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0E, 0x00, 0x87, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0xFF, 0x8F, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x06, 0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0C, 0x00, 0x8D, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0xFF, 0x8D,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0x00,
+    0x8F, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
+    0xBF, 0x0C, 0x00, 0x91, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x02, 0xFF, 0x8B, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0C, 0x00, 0x93, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04,
+    0xFF, 0x87, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0x00, 0x8F, 0x05, 0xBF, 0x05,
+    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0C, 0x00, 0x97,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0xFF, 0x83, 0xFE, 0x40, 0xFE, 0x40, 0x04,
+    0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF,
+    0x05, 0xBF, 0x0C, 0x00, 0x9B, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0x02, 0xFF, 0x81, 0xFE, 0x40, 0x04, 0x00, 0x8F, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
+    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0C, 0x00, 0x9D, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0xFF, 0x02, 0x00, 0x8F, 0x05,
+    0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x0E,
+    0x00, 0x9B, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x04, 0x00,
+    0x04, 0xFF, 0x8D, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05,
+    0xBF, 0x10, 0x00, 0x97, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x08, 0x00, 0x81, 0x05,
+    0xBF, 0x02, 0xFF, 0x8B, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF,
+    0x10, 0x00, 0x97, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0x08, 0x00, 0x83, 0x05, 0xBF,
+    0x05, 0xBF, 0x04, 0xFF, 0x87, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x05, 0xBF, 0x14, 0x00, 0x8F,
+    0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40,
+    0x14, 0x00, 0x02, 0xFF, 0x1C, 0x00, 0x8B, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE, 0x40, 0xFE,
+    0x40, 0xFE, 0x40, 0x18, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E, 0x30,
+    0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C, 0x30,
+    0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA, 0x30,
+    0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8, 0x30,
+    0xFF, 0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E,
+    0x30, 0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C,
+    0x30, 0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA,
+    0x30, 0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8,
+    0x30, 0x07, 0xF0, 0x0F, 0xB0, 0x17, 0x70, 0x1F, 0x30, 0x26, 0xF0, 0x2E, 0xB0, 0x36, 0x70, 0x3E,
+    0x30, 0x45, 0xF0, 0x4D, 0xB0, 0x55, 0x70, 0x5D, 0x30, 0x64, 0xF0, 0x6C, 0xB0, 0x74, 0x70, 0x7C,
+    0x30, 0x83, 0xF0, 0x8B, 0xB0, 0x93, 0x70, 0x9B, 0x30, 0xA2, 0xF0, 0xAA, 0xB0, 0xB2, 0x70, 0xBA,
+    0x30, 0xC1, 0xF0, 0xC9, 0xB0, 0xD1, 0x70, 0xD9, 0x30, 0xE0, 0xF0, 0xE8, 0xB0, 0xF0, 0x70, 0xF8,
+    0x30, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x04, 0xFF,
+};
+// clang-format on
+
+const uint32_t font_bench_length = 1997;
+
+// clang-format off
+const uint8_t font_bench[1997] = {
+    0x00, 0xFF, 0x14, 0x00, 0x00, 0x51, 0x46, 0x46, 0x01, 0xCD, 0x07, 0x00, 0x00, 0x32, 0xF8, 0xFF,
+    0xFF, 0x0C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x1D, 0x01, 0x00, 0x07, 0x00,
+    0x00, 0x87, 0x00, 0x00, 0x47, 0x05, 0x00, 0x47, 0x08, 0x00, 0x07, 0x0D, 0x00, 0x07, 0x12, 0x00,
+    0xC7, 0x16, 0x00, 0x87, 0x1B, 0x00, 0x47, 0x1E, 0x00, 0xC7, 0x23, 0x00, 0x47, 0x29, 0x00, 0x07,
+    0x2D, 0x00, 0x07, 0x31, 0x00, 0xC7, 0x33, 0x00, 0x87, 0x35, 0x00, 0xC7, 0x37, 0x00, 0xC7, 0x3C,
+    0x00, 0x87, 0x41, 0x00, 0x47, 0x46, 0x00, 0x07, 0x4B, 0x00, 0xC7, 0x4F, 0x00, 0x87, 0x54, 0x00,
+    0x47, 0x59, 0x00, 0x47, 0x5E, 0x00, 0xC7, 0x62, 0x00, 0x87, 0x67, 0x00, 0x87, 0x6C, 0x00, 0x87,
+    0x70, 0x00, 0x07, 0x75, 0x00, 0x47, 0x79, 0x00, 0x07, 0x7C, 0x00, 0x47, 0x80, 0x00, 0x07, 0x85,
+    0x00, 0x87, 0x8A, 0x00, 0x47, 0x8F, 0x00, 0x07, 0x94, 0x00, 0xC7, 0x98, 0x00, 0x87, 0x9D, 0x00,
+    0x47, 0xA2, 0x00, 0xC7, 0xA6, 0x00, 0x87, 0xAB, 0x00, 0x47, 0xB0, 0x00, 0x07, 0xB5, 0x00, 0xC7,
+    0xB9, 0x00, 0x87, 0xBE, 0x00, 0x47, 0xC3, 0x00, 0x07, 0xC8, 0x00, 0xC7, 0xCC, 0x00, 0x87, 0xD1,
+    0x00, 0x47, 0xD6, 0x00, 0xC7, 0xDB, 0x00, 0x87, 0xE0, 0x00, 0x87, 0xE5, 0x00, 0x07, 0xEA, 0x00,
+    0xC7, 0xEE, 0x00, 0x88, 0xF3, 0x00, 0xC7, 0xF8, 0x00, 0x87, 0xFD, 0x00, 0x07, 0x02, 0x01, 0xC7,
+    0x06, 0x01, 0x47, 0x0C, 0x01, 0x87, 0x11, 0x01, 0x07, 0x17, 0x01, 0x87, 0x1A, 0x01, 0x47, 0x1C,
+    0x01, 0xC7, 0x1D, 0x01, 0xC7, 0x21, 0x01, 0x87, 0x26, 0x01, 0x87, 0x2A, 0x01, 0x47, 0x2F, 0x01,
+    0x87, 0x33, 0x01, 0x07, 0x38, 0x01, 0xC7, 0x3C, 0x01, 0x87, 0x41, 0x01, 0x87, 0x46, 0x01, 0x47,
+    0x4C, 0x01, 0x07, 0x51, 0x01, 0xC7, 0x55, 0x01, 0xC7, 0x59, 0x01, 0xC7, 0x5D, 0x01, 0xC7, 0x61,
+    0x01, 0x47, 0x66, 0x01, 0x07, 0x6B, 0x01, 0xC7, 0x6E, 0x01, 0x07, 0x73, 0x01, 0x47, 0x77, 0x01,
+    0x47, 0x7B, 0x01, 0x48, 0x7F, 0x01, 0x87, 0x83, 0x01, 0xC7, 0x87, 0x01, 0x87, 0x8C, 0x01, 0x87,
+    0x90, 0x01, 0x07, 0x96, 0x01, 0x87, 0x9B, 0x01, 0x07, 0xA1, 0x01, 0x04, 0xFB, 0x8D, 0x06, 0x00,
+    0x15, 0x00, 0x02, 0x00, 0x87, 0x30, 0x00, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x20, 0x03, 0x00, 0x82,
+    0x07, 0xC0, 0x01, 0x05, 0x00, 0x02, 0x00, 0x86, 0x8D, 0x42, 0xA3, 0x90, 0x18, 0x20, 0x05, 0x0C,
+    0x00, 0x02, 0x00, 0x8D, 0x54, 0x01, 0x52, 0xE0, 0x7F, 0x20, 0x02, 0x88, 0xC0, 0xFF, 0x80, 0x08,
+    0x14, 0x02, 0x05, 0x00, 0x90, 0x80, 0x00, 0x20, 0x00, 0x7E, 0xA0, 0x10, 0xA4, 0x01, 0x90, 0x82,
+    0xC1, 0x90, 0x1F, 0x80, 0x00, 0x20, 0x04, 0x00, 0x8F, 0x00, 0x40, 0x1F, 0x60, 0x49, 0x5A, 0x22,
+    0x7C, 0x01, 0x80, 0x07, 0x15, 0x62, 0x85, 0x05, 0x1E, 0x05, 0x00, 0x02, 0x00, 0x8D, 0x78, 0x40,
+    0x26, 0x50, 0x06, 0xB4, 0x10, 0x1A, 0x99, 0x98, 0x24, 0x2C, 0xF8, 0x25, 0x05, 0x00, 0x02, 0x00,
+    0x85, 0x70, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x0D, 0x00, 0x92, 0x00, 0x05, 0x90, 0x00, 0x08, 0x40,
+    0x02, 0x50, 0x00, 0x14, 0x00, 0x05, 0x40, 0x02, 0x80, 0x00, 0x90, 0x00, 0x50, 0x02, 0x00, 0x92,
+    0x24, 0x00, 0x18, 0x00, 0x08, 0x00, 0x06, 0x40, 0x02, 0x90, 0x00, 0x24, 0x00, 0x06, 0x80, 0x00,
+    0x18, 0x40, 0x02, 0x02, 0x00, 0x04, 0x00, 0x89, 0x04, 0x00, 0x02, 0xE8, 0x0A, 0xB4, 0x00, 0x26,
+    0x80, 0x14, 0x07, 0x00, 0x04, 0x00, 0x8A, 0x04, 0x00, 0x02, 0x80, 0x00, 0xFF, 0x07, 0x08, 0x00,
+    0x02, 0x40, 0x06, 0x00, 0x0D, 0x00, 0x87, 0x07, 0xC0, 0x02, 0x90, 0x00, 0x18, 0x40, 0x00, 0x09,
+    0x00, 0x81, 0xFF, 0x07, 0x0A, 0x00, 0x0C, 0x00, 0x83, 0x40, 0x07, 0xD0, 0x01, 0x05, 0x00, 0x90,
+    0x00, 0x08, 0x40, 0x01, 0x20, 0x00, 0x09, 0x80, 0x01, 0x20, 0x00, 0x05, 0x80, 0x00, 0x24, 0x00,
+    0x06, 0x04, 0x00, 0x02, 0x00, 0x8D, 0xB8, 0x81, 0x92, 0x30, 0x60, 0xC8, 0x19, 0x72, 0xC6, 0x80,
+    0xA0, 0x24, 0xE0, 0x06, 0x05, 0x00, 0x02, 0x00, 0x8D, 0x7D, 0x00, 0x19, 0x00, 0x06, 0x80, 0x01,
+    0x60, 0x00, 0x18, 0x00, 0x06, 0xF8, 0x1F, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xB9, 0x80, 0xA1, 0x00,
+    0x20, 0x00, 0x05, 0x90, 0x00, 0x09, 0x90, 0x00, 0xFC, 0x1F, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xB9,
+    0x81, 0xD1, 0x00, 0x24, 0xE0, 0x02, 0x40, 0x02, 0xC0, 0x20, 0x34, 0xF4, 0x06, 0x05, 0x00, 0x02,
+    0x00, 0x8D, 0xC0, 0x01, 0x68, 0x80, 0x19, 0x24, 0x06, 0x82, 0xE1, 0xFF, 0x02, 0x18, 0x00, 0x06,
+    0x05, 0x00, 0x02, 0x00, 0x8D, 0xFD, 0x83, 0x01, 0x60, 0x00, 0xF8, 0x07, 0x40, 0x03, 0x80, 0x21,
+    0x34, 0xF4, 0x06, 0x05, 0x00, 0x02, 0x00, 0x80, 0xF8, 0x02, 0x42, 0x8A, 0x30, 0x00, 0xDC, 0x07,
+    0x0B, 0xC7, 0x80, 0xA1, 0x34, 0xE0, 0x07, 0x05, 0x00, 0x02, 0x00, 0x8C, 0xFF, 0x07, 0x80, 0x00,
+    0x08, 0x40, 0x02, 0x60, 0x00, 0x0C, 0x00, 0x03, 0x90, 0x06, 0x00, 0x02, 0x00, 0x8D, 0xF9, 0x81,
+    0xD1, 0x90, 0x35, 0xF4, 0x07, 0x87, 0x82, 0x80, 0x71, 0x70, 0xE4, 0x07, 0x05, 0x00, 0x02, 0x00,
+    0x82, 0xB9, 0xC0, 0x91, 0x02, 0x20, 0x88, 0x1C, 0x1D, 0xBD, 0x06, 0xC0, 0x10, 0x28, 0xF4, 0x02,
+    0x05, 0x00, 0x05, 0x00, 0x83, 0x40, 0x07, 0xD0, 0x01, 0x03, 0x00, 0x83, 0x40, 0x07, 0xD0, 0x01,
+    0x05, 0x00, 0x05, 0x00, 0x83, 0x40, 0x07, 0xD0, 0x01, 0x04, 0x00, 0x87, 0x07, 0xC0, 0x02, 0x90,
+    0x00, 0x18, 0x40, 0x00, 0x04, 0x00, 0x8B, 0x80, 0x00, 0x1D, 0xA0, 0x00, 0x0A, 0x00, 0x0A, 0x00,
+    0x1D, 0x00, 0x08, 0x05, 0x00, 0x07, 0x00, 0x85, 0xFC, 0x1F, 0x00, 0xC0, 0xFF, 0x01, 0x08, 0x00,
+    0x03, 0x00, 0x8B, 0x80, 0x01, 0x90, 0x02, 0x80, 0x06, 0x40, 0x02, 0x68, 0x90, 0x02, 0x18, 0x06,
+    0x00, 0x02, 0x00, 0x87, 0xB8, 0x41, 0x91, 0x00, 0x14, 0x40, 0x02, 0x30, 0x02, 0x00, 0x82, 0x40,
+    0x03, 0xD0, 0x06, 0x00, 0x02, 0x00, 0x90, 0xF8, 0x81, 0x82, 0x31, 0x50, 0x49, 0x6E, 0x61, 0x59,
+    0x89, 0x26, 0x5E, 0x0C, 0x00, 0x09, 0x01, 0x7D, 0x02, 0x00, 0x02, 0x00, 0x8D, 0x70, 0x00, 0x29,
+    0x80, 0x0C, 0x30, 0x06, 0x49, 0x82, 0xFF, 0x30, 0x60, 0x09, 0x24, 0x05, 0x00, 0x02, 0x00, 0x8D,
+    0xFE, 0x81, 0xD1, 0x60, 0x34, 0xF8, 0x07, 0x06, 0x86, 0x41, 0x62, 0x74, 0xF8, 0x07, 0x05, 0x00,
+    0x02, 0x00, 0x8D, 0xF4, 0x42, 0x46, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x90, 0x51, 0xD0,
+    0x0B, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xBF, 0xC0, 0xE0, 0x30, 0x60, 0x0C, 0x28, 0x03, 0xCA, 0x80,
+    0x31, 0x38, 0xFC, 0x02, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xFE, 0x87, 0x01, 0x60, 0x00, 0xF8, 0x0B,
+    0x06, 0x80, 0x01, 0x60, 0x00, 0xF8, 0x1F, 0x05, 0x00, 0x02, 0x00, 0x8C, 0xFD, 0x47, 0x02, 0x90,
+    0x00, 0xF4, 0x0F, 0x09, 0x40, 0x02, 0x90, 0x00, 0x24, 0x06, 0x00, 0x02, 0x00, 0x8D, 0xF8, 0x82,
+    0x42, 0x30, 0x00, 0x09, 0x40, 0xC2, 0xC7, 0x80, 0xA1, 0x60, 0xE0, 0x0B, 0x05, 0x00, 0x02, 0x00,
+    0x8D, 0x03, 0xC6, 0x80, 0x31, 0x60, 0xFC, 0x1F, 0x03, 0xC6, 0x80, 0x31, 0x60, 0x0C, 0x18, 0x05,
+    0x00, 0x02, 0x00, 0x8D, 0xFF, 0x03, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+    0xFC, 0x0F, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xFD, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+    0xC0, 0x60, 0x28, 0xE4, 0x02, 0x05, 0x00, 0x02, 0x00, 0x8D, 0x06, 0x86, 0x61, 0x60, 0x0A, 0xE8,
+    0x01, 0xDE, 0x80, 0xA1, 0x60, 0x30, 0x18, 0x24, 0x05, 0x00, 0x02, 0x00, 0x8D, 0x09, 0x40, 0x02,
+    0x90, 0x00, 0x24, 0x00, 0x09, 0x40, 0x02, 0x90, 0x00, 0xF4, 0x1F, 0x05, 0x00, 0x02, 0x00, 0x8D,
+    0x07, 0xC7, 0xD2, 0xA1, 0x68, 0x28, 0x1A, 0x66, 0x86, 0x88, 0x21, 0x60, 0x08, 0x18, 0x05, 0x00,
+    0x02, 0x00, 0x8D, 0x07, 0xC6, 0x82, 0xB1, 0x61, 0x8C, 0x18, 0x63, 0xC6, 0xA0, 0x31, 0x68, 0x0C,
+    0x1C, 0x05, 0x00, 0x02, 0x00, 0x8D, 0xB8, 0x81, 0xD1, 0x34, 0x60, 0x09, 0x64, 0x02, 0xD9, 0x80,
+    0x61, 0x34, 0xE0, 0x06, 0x05, 0x00, 0x02, 0x00, 0x84, 0xFE, 0x82, 0x81, 0x61, 0x60, 0x02, 0x18,
+    0x85, 0xFE, 0x81, 0x01, 0x60, 0x00, 0x18, 0x06, 0x00, 0x02, 0x00, 0x92, 0xB8, 0x81, 0xD1, 0x34,
+    0x60, 0x09, 0x64, 0x02, 0xD9, 0x80, 0xA1, 0x34, 0xE0, 0x06, 0xA0, 0x00, 0xE0, 0x02, 0x00, 0x02,
+    0x00, 0x8B, 0xFE, 0x81, 0xD1, 0x61, 0x60, 0x18, 0x1D, 0xFE, 0x81, 0x31, 0x60, 0x24, 0x02, 0x18,
+    0x05, 0x00, 0x02, 0x00, 0x80, 0xF8, 0x02, 0x81, 0x8A, 0x60, 0x00, 0xB0, 0x01, 0x90, 0x02, 0x80,
+    0x61, 0x70, 0xE4, 0x07, 0x05, 0x00, 0x8E, 0x00, 0x80, 0xFF, 0x0B, 0x0C, 0x00, 0x03, 0xC0, 0x00,
+    0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0x00, 0x02, 0x00, 0x8D, 0x03, 0xC6, 0x80, 0x31, 0x60,
+    0x0C, 0x18, 0x03, 0xC6, 0x80, 0xA0, 0x34, 0xE0, 0x07, 0x05, 0x00, 0x8F, 0x00, 0x40, 0x02, 0xC9,
+    0x80, 0x61, 0x30, 0x24, 0x09, 0x8C, 0x01, 0x36, 0x40, 0x0A, 0xC0, 0x01, 0x05, 0x00, 0x02, 0x00,
+    0x8F, 0x06, 0x30, 0x06, 0x30, 0xC6, 0x24, 0x89, 0x25, 0x59, 0x16, 0x28, 0x1A, 0x28, 0x0A, 0x28,
+    0x0D, 0x06, 0x00, 0x02, 0x00, 0x8D, 0x07, 0x43, 0x92, 0x80, 0x0D, 0xD0, 0x01, 0xB4, 0x00, 0x33,
+    0xA0, 0x24, 0x0C, 0x18, 0x05, 0x00, 0x8E, 0x00, 0x40, 0x02, 0x86, 0xC1, 0x90, 0x14, 0x60, 0x03,
+    0x74, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0x00, 0x02, 0x00, 0x8D, 0xFF, 0x07, 0x90, 0x00, 0x18,
+    0x80, 0x01, 0x24, 0x00, 0x03, 0x60, 0x00, 0xFD, 0x1F, 0x05, 0x00, 0x92, 0xD0, 0x0F, 0x14, 0x00,
+    0x05, 0x40, 0x01, 0x50, 0x00, 0x14, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x14, 0x00, 0xFD, 0x02,
+    0x00, 0x91, 0x18, 0x00, 0x09, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0x60, 0x00, 0x24, 0x00, 0x08,
+    0x00, 0x05, 0x00, 0x02, 0x03, 0x00, 0x92, 0xF8, 0x02, 0x90, 0x00, 0x24, 0x00, 0x09, 0x40, 0x02,
+    0x90, 0x00, 0x24, 0x00, 0x09, 0x40, 0x02, 0x90, 0x80, 0x2F, 0x02, 0x00, 0x02, 0x00, 0x88, 0x70,
+    0x00, 0x29, 0x80, 0x08, 0x20, 0x06, 0x45, 0x02, 0x0A, 0x00, 0x11, 0x00, 0x83, 0xD0, 0xFF, 0x01,
+    0x00, 0x82, 0x90, 0x00, 0x20, 0x12, 0x00, 0x05, 0x00, 0x8A, 0x90, 0x1F, 0x14, 0x0D, 0xE4, 0x87,
+    0x86, 0x31, 0x74, 0xF4, 0x1A, 0x05, 0x00, 0x8F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x1F, 0x2C,
+    0x1D, 0x03, 0xC6, 0x80, 0xB1, 0x34, 0xEC, 0x07, 0x05, 0x00, 0x05, 0x00, 0x8A, 0x80, 0x2F, 0x28,
+    0x04, 0x03, 0xC0, 0x00, 0xA0, 0x50, 0xE0, 0x0B, 0x05, 0x00, 0x8F, 0x00, 0x0C, 0x00, 0x03, 0xC0,
+    0x90, 0x3B, 0x1C, 0x4D, 0x02, 0x93, 0xC0, 0x70, 0x34, 0xF4, 0x0A, 0x05, 0x00, 0x05, 0x00, 0x81,
+    0x80, 0x1F, 0x02, 0x18, 0x86, 0xFF, 0xC7, 0x00, 0xA0, 0x10, 0xE0, 0x0B, 0x05, 0x00, 0x8E, 0x40,
+    0x2F, 0x70, 0x00, 0x0C, 0xE0, 0x7F, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0x00,
+    0x05, 0x00, 0x8D, 0x80, 0xBF, 0x18, 0x09, 0x46, 0x42, 0x2F, 0x60, 0x00, 0xF4, 0x1F, 0x03, 0x8A,
+    0xBF, 0x02, 0x00, 0x8F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x2F, 0x2C, 0x0C, 0x03, 0xC6, 0x80,
+    0x31, 0x60, 0x0C, 0x18, 0x05, 0x00, 0x82, 0x40, 0x02, 0x90, 0x02, 0x00, 0x8A, 0xF0, 0x0B, 0x40,
+    0x02, 0x90, 0x00, 0x24, 0x00, 0x09, 0x40, 0x02, 0x05, 0x00, 0x82, 0x40, 0x02, 0x90, 0x02, 0x00,
+    0x8D, 0xF0, 0x0B, 0x40, 0x02, 0x90, 0x00, 0x24, 0x00, 0x09, 0x40, 0x02, 0xA0, 0xC0, 0x0B, 0x02,
+    0x00, 0x8F, 0x18, 0x00, 0x06, 0x80, 0x01, 0x60, 0x20, 0x58, 0x02, 0x76, 0x80, 0x36, 0x60, 0x24,
+    0x18, 0x28, 0x05, 0x00, 0x8F, 0xFC, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00,
+    0x0C, 0x00, 0x07, 0x40, 0x1F, 0x05, 0x00, 0x05, 0x00, 0x8A, 0xE4, 0x7A, 0xCD, 0x65, 0x22, 0x99,
+    0x48, 0x26, 0x92, 0x89, 0x24, 0x05, 0x00, 0x05, 0x00, 0x8A, 0x70, 0x2F, 0x2C, 0x0C, 0x03, 0xC6,
+    0x80, 0x31, 0x60, 0x0C, 0x18, 0x05, 0x00, 0x05, 0x00, 0x8A, 0x80, 0x1B, 0x1C, 0x4D, 0x02, 0x96,
+    0x80, 0x71, 0x34, 0xE0, 0x06, 0x05, 0x00, 0x05, 0x00, 0x8C, 0x70, 0x1F, 0x2C, 0x1D, 0x03, 0xC6,
+    0x80, 0x71, 0x34, 0xEC, 0x07, 0x03, 0xC0, 0x03, 0x00, 0x05, 0x00, 0x8D, 0x90, 0x2B, 0x1C, 0x4D,
+    0x02, 0x93, 0xC0, 0x70, 0x34, 0xF4, 0x0E, 0x00, 0x03, 0xC0, 0x02, 0x00, 0x05, 0x00, 0x89, 0x90,
+    0x7D, 0xB4, 0x00, 0x09, 0x40, 0x02, 0x90, 0x00, 0x24, 0x06, 0x00, 0x05, 0x00, 0x86, 0x90, 0x1F,
+    0x18, 0x04, 0x69, 0x00, 0xA4, 0x02, 0x60, 0x81, 0xE4, 0x0B, 0x05, 0x00, 0x04, 0x00, 0x8B, 0x05,
+    0xF0, 0x7F, 0x60, 0x00, 0x18, 0x00, 0x06, 0x40, 0x02, 0x80, 0x1F, 0x05, 0x00, 0x05, 0x00, 0x02,
+    0x30, 0x02, 0x0C, 0x86, 0x03, 0xC3, 0xC0, 0x70, 0x38, 0xF4, 0x09, 0x05, 0x00, 0x05, 0x00, 0x8A,
+    0x24, 0x60, 0x18, 0x0C, 0x49, 0x02, 0x63, 0x80, 0x0A, 0xC0, 0x01, 0x05, 0x00, 0x06, 0x00, 0x8B,
+    0xC6, 0x30, 0xC6, 0x21, 0x59, 0x26, 0x28, 0x1A, 0x2C, 0x0A, 0x28, 0x0D, 0x06, 0x00, 0x05, 0x00,
+    0x87, 0x60, 0x20, 0x30, 0x06, 0xB4, 0x00, 0x29, 0x90, 0x02, 0x18, 0x80, 0x0C, 0x05, 0x00, 0x05,
+    0x00, 0x8D, 0x24, 0x60, 0x18, 0x08, 0x49, 0x02, 0x22, 0x40, 0x0A, 0xC0, 0x01, 0x24, 0xC0, 0x02,
+    0x02, 0x00, 0x05, 0x00, 0x8A, 0xE0, 0x7F, 0x00, 0x0A, 0xA0, 0x00, 0x09, 0x90, 0x00, 0xFC, 0x1F,
+    0x05, 0x00, 0x92, 0x40, 0x0F, 0x30, 0x00, 0x08, 0x00, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x0D, 0x00,
+    0x02, 0x80, 0x00, 0x30, 0x00, 0xF4, 0x02, 0x00, 0x94, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+    0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x92, 0xB8,
+    0x00, 0x30, 0x00, 0x08, 0x00, 0x02, 0x80, 0x01, 0xD0, 0x02, 0x18, 0x00, 0x02, 0x80, 0x00, 0x30,
+    0x80, 0x0B, 0x02, 0x00, 0x07, 0x00, 0x83, 0xB4, 0x08, 0xE2, 0x02, 0x0A, 0x00,
+};
+// clang-format on
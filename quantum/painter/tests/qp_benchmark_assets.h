@@ -0,0 +1,39 @@
+// Copyright 2024 QMK -- generated source code only, font retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <qp.h>
+
+extern const uint32_t gfx_bench_mono2_raw_length;
+extern const uint8_t  gfx_bench_mono2_raw[176];
+
+extern const uint32_t gfx_bench_mono2_rle_length;
+extern const uint8_t  gfx_bench_mono2_rle[149];
+
+extern const uint32_t gfx_bench_mono4_raw_length;
+extern const uint8_t  gfx_bench_mono4_raw[304];
+
+extern const uint32_t gfx_bench_mono4_rle_length;
+extern const uint8_t  gfx_bench_mono4_rle[215];
+
+extern const uint32_t gfx_bench_pal16_raw_length;
+extern const uint8_t  gfx_bench_pal16_raw[613];
+
+extern const uint32_t gfx_bench_pal16_rle_length;
+extern const uint8_t  gfx_bench_pal16_rle[365];
+
+extern const uint32_t gfx_bench_pal256_raw_length;
+extern const uint8_t  gfx_bench_pal256_raw[1845];
+
+extern const uint32_t gfx_bench_pal256_rle_length;
+extern const uint8_t  gfx_bench_pal256_rle[1138];
+
+extern const uint32_t gfx_bench_rgb565_raw_length;
+extern const uint8_t  gfx_bench_rgb565_raw[2096];
+
+extern const uint32_t gfx_bench_rgb565_rle_length;
+extern const uint8_t  gfx_bench_rgb565_rle[1019];
+
+extern const uint32_t font_bench_length;
+extern const uint8_t  font_bench[1997];
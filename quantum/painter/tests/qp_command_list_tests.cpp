@@ -0,0 +1,150 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_command_list.h"
+#include "qp_surface_internal.h"
+#include "fnv.h"
+#include "qp_benchmark_assets.h"
+}
+
+#define LIST_WIDTH 240
+#define LIST_HEIGHT 64
+
+static uint8_t                  list_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(LIST_WIDTH, LIST_HEIGHT, 16)];
+static surface_painter_device_t list_device;
+
+class QuantumPainterCommandList : public ::testing::Test {
+   protected:
+    painter_device_t      device;
+    painter_font_handle_t font;
+
+    void SetUp() override {
+        memset(&list_device, 0, sizeof(list_device));
+        memset(list_framebuffer, 0, sizeof(list_framebuffer));
+        device = qp_make_rgb565_surface_advanced(&list_device, 1, LIST_WIDTH, LIST_HEIGHT, list_framebuffer);
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        font = qp_load_font_mem(font_bench);
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_command_list_end();
+        drain();
+        qp_close_font(font);
+    }
+
+    static void drain(void) {
+        while (!qp_command_list_done()) {
+            qp_internal_command_list_task();
+        }
+    }
+
+    static uint32_t framebuffer_hash(void) {
+        return fnv_32a_buf(list_framebuffer, sizeof(list_framebuffer), FNV1_32A_INIT);
+    }
+
+    // Draws immediately, returning the resulting framebuffer hash, then clears the framebuffer again
+    template <typename F>
+    static uint32_t draw_immediately(F &&draw) {
+        draw();
+        uint32_t hash = framebuffer_hash();
+        memset(list_framebuffer, 0, sizeof(list_framebuffer));
+        return hash;
+    }
+};
+
+/**
+ * This test verifies that recorded draw calls are deferred until the task runs, and then draw the same pixels.
+ */
+TEST_F(QuantumPainterCommandList, RecordedCallsMatchImmediate) {
+    auto draw = [&]() {
+        EXPECT_TRUE(qp_rect(device, 0, 0, 39, 19, 0, 255, 255, true));
+        EXPECT_TRUE(qp_line(device, 0, 63, 239, 0, 85, 255, 255));
+        EXPECT_TRUE(qp_circle(device, 120, 32, 20, 170, 255, 255, false));
+        EXPECT_EQ(qp_drawtext(device, 50, 0, font, "Deferred"), qp_textwidth(font, "Deferred"));
+    };
+    uint32_t expected = draw_immediately(draw);
+
+    ASSERT_TRUE(qp_command_list_begin());
+    draw();
+    qp_command_list_end();
+    EXPECT_FALSE(qp_command_list_done());
+    EXPECT_EQ(framebuffer_hash(), draw_immediately([]() {})) << "Recorded calls were drawn immediately";
+
+    drain();
+    EXPECT_EQ(framebuffer_hash(), expected) << "Recorded calls drew different pixels";
+}
+
+/**
+ * This test verifies that prepared text is recorded, and drawn as it was when recorded.
+ */
+TEST_F(QuantumPainterCommandList, PreparedText) {
+    painter_prepared_text_t prepared;
+    ASSERT_TRUE(qp_prepare_text(&prepared, font, "Prepared"));
+    uint32_t expected = draw_immediately([&]() { qp_drawtext_prepared_recolor(device, 10, 10, &prepared, 0, 255, 255, 0, 0, 0); });
+
+    ASSERT_TRUE(qp_command_list_begin());
+    EXPECT_EQ(qp_drawtext_prepared_recolor(device, 10, 10, &prepared, 0, 255, 255, 0, 0, 0), prepared.width);
+    qp_command_list_end();
+    EXPECT_FALSE(qp_command_list_done()) << "Prepared text was not recorded";
+
+    // Re-preparing the caller's copy must not affect what was recorded
+    ASSERT_TRUE(qp_prepare_text(&prepared, font, "Changed"));
+    drain();
+    EXPECT_EQ(framebuffer_hash(), expected) << "Recorded prepared text drew different pixels";
+}
+
+/**
+ * This test verifies that recorded prepared text is skipped if its font is closed before it is drawn.
+ */
+TEST_F(QuantumPainterCommandList, PreparedTextClosedFont) {
+    painter_prepared_text_t prepared;
+    ASSERT_TRUE(qp_prepare_text(&prepared, font, "Prepared"));
+
+    ASSERT_TRUE(qp_command_list_begin());
+    EXPECT_GT(qp_drawtext_prepared(device, 0, 0, &prepared), 0);
+    qp_command_list_end();
+
+    EXPECT_TRUE(qp_close_font(font));
+    font = qp_load_font_mem(font_bench);
+    ASSERT_NE(font, nullptr);
+    drain();
+    EXPECT_EQ(framebuffer_hash(), draw_immediately([]() {})) << "Prepared text was drawn after its font was closed";
+}
+
+/**
+ * This test verifies that the command list can be filled to its full size, which is close to the limit of its uint16_t
+ * positions, and that it can be reused once drained.
+ */
+TEST_F(QuantumPainterCommandList, FillToCapacity) {
+    ASSERT_EQ(QUANTUM_PAINTER_COMMAND_LIST_SIZE, UINT16_MAX) << "Test expects the largest supported command list";
+
+    size_t padded   = (sizeof(qp_command_t) + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    size_t capacity = QUANTUM_PAINTER_COMMAND_LIST_SIZE / padded;
+    auto   draw     = [&](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_TRUE(qp_setpixel(device, i % LIST_WIDTH, i / LIST_WIDTH, i, 255, 255)) << "Command " << i << " was not recorded";
+        }
+    };
+    uint32_t expected = draw_immediately([&]() { draw(capacity); });
+
+    ASSERT_TRUE(qp_command_list_begin());
+    draw(capacity);
+    EXPECT_FALSE(qp_setpixel(device, 0, 0, 0, 0, 0)) << "Command was recorded beyond the end of the list";
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "Full"), 0) << "Text was recorded beyond the end of the list";
+    qp_command_list_end();
+
+    drain();
+    EXPECT_EQ(framebuffer_hash(), expected) << "Full command list drew different pixels";
+
+    // Once drained, recording starts again from the beginning of the list
+    ASSERT_TRUE(qp_command_list_begin());
+    draw(capacity);
+    qp_command_list_end();
+    drain();
+    EXPECT_EQ(framebuffer_hash(), expected);
+}
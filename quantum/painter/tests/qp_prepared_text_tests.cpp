@@ -0,0 +1,111 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+#include "fnv.h"
+#include "qp_benchmark_assets.h"
+}
+
+#define TEXT_WIDTH 240
+#define TEXT_HEIGHT 32
+
+static uint8_t                  text_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEXT_WIDTH, TEXT_HEIGHT, 16)];
+static surface_painter_device_t text_device;
+
+class QuantumPainterPreparedText : public ::testing::Test {
+   protected:
+    painter_device_t      device;
+    painter_font_handle_t font;
+
+    void SetUp() override {
+        memset(&text_device, 0, sizeof(text_device));
+        memset(text_framebuffer, 0, sizeof(text_framebuffer));
+        device = qp_make_rgb565_surface_advanced(&text_device, 1, TEXT_WIDTH, TEXT_HEIGHT, text_framebuffer);
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        font = qp_load_font_mem(font_bench);
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        if (font) {
+            qp_close_font(font);
+        }
+    }
+
+    static uint32_t framebuffer_hash(void) {
+        return fnv_32a_buf(text_framebuffer, sizeof(text_framebuffer), FNV1_32A_INIT);
+    }
+};
+
+/**
+ * This test verifies that prepared text is drawn identically to the string it was prepared from.
+ */
+TEST_F(QuantumPainterPreparedText, DrawMatchesDrawText) {
+    int16_t width = qp_drawtext(device, 0, 0, font, "Prepared");
+    EXPECT_EQ(width, qp_textwidth(font, "Prepared"));
+    uint32_t expected = framebuffer_hash();
+
+    memset(text_framebuffer, 0, sizeof(text_framebuffer));
+    painter_prepared_text_t prepared;
+    ASSERT_TRUE(qp_prepare_text(&prepared, font, "Prepared"));
+    EXPECT_EQ(prepared.width, width);
+    EXPECT_EQ(qp_drawtext_prepared(device, 0, 0, &prepared), width);
+    EXPECT_EQ(framebuffer_hash(), expected) << "Prepared text drew different pixels";
+}
+
+/**
+ * This test verifies that qp_prepare_text_if_changed() only re-prepares when the string or font changes.
+ */
+TEST_F(QuantumPainterPreparedText, IfChanged) {
+    painter_prepared_text_t prepared = {0};
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abc"));
+    EXPECT_FALSE(qp_prepare_text_if_changed(&prepared, font, "abc"));
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abd"));
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "ab"));
+    EXPECT_EQ(prepared.num_glyphs, 2);
+}
+
+/**
+ * This test verifies that a failure to re-prepare is reported, and leaves the prepared text unusable.
+ */
+TEST_F(QuantumPainterPreparedText, IfChangedFailure) {
+    char too_long[QUANTUM_PAINTER_PREPARED_TEXT_MAX_GLYPHS + 2];
+    memset(too_long, 'a', sizeof(too_long) - 1);
+    too_long[sizeof(too_long) - 1] = '\0';
+
+    painter_prepared_text_t prepared = {0};
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abc"));
+    EXPECT_FALSE(qp_prepare_text_if_changed(&prepared, font, too_long)) << "Failure was reported as a change";
+    EXPECT_EQ(prepared.font, nullptr) << "Failed preparation left a usable font";
+    EXPECT_EQ(prepared.num_glyphs, 0);
+    EXPECT_EQ(qp_drawtext_prepared(device, 0, 0, &prepared), 0) << "Failed preparation was drawn";
+
+    // A glyph missing from the font fails the same way, and the text is prepared again once it is valid
+    ASSERT_EQ(qp_textwidth(font, "\xE2\x82\xAC"), 0) << "Test expects the font to lack the euro sign";
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abc"));
+    EXPECT_FALSE(qp_prepare_text_if_changed(&prepared, font, "a\xE2\x82\xAC")) << "Failure was reported as a change";
+    EXPECT_EQ(prepared.font, nullptr) << "Failed preparation left a usable font";
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abc")) << "Text was not prepared again after a failure";
+    EXPECT_GT(qp_drawtext_prepared(device, 0, 0, &prepared), 0);
+}
+
+/**
+ * This test verifies that text prepared with a closed font is rejected, even once the font's slot is reused.
+ */
+TEST_F(QuantumPainterPreparedText, ClosedFont) {
+    painter_prepared_text_t prepared;
+    ASSERT_TRUE(qp_prepare_text(&prepared, font, "abc"));
+    EXPECT_TRUE(qp_close_font(font));
+    EXPECT_EQ(qp_drawtext_prepared(device, 0, 0, &prepared), 0) << "Text prepared with a closed font was drawn";
+
+    // The first free slot is reused, so the new font has the same handle
+    painter_font_handle_t reloaded = qp_load_font_mem(font_bench);
+    ASSERT_EQ(reloaded, font);
+    EXPECT_EQ(qp_drawtext_prepared(device, 0, 0, &prepared), 0) << "Text prepared with a previous font in the same slot was drawn";
+    EXPECT_TRUE(qp_prepare_text_if_changed(&prepared, font, "abc")) << "Text prepared with a closed font was not re-prepared";
+    EXPECT_GT(qp_drawtext_prepared(device, 0, 0, &prepared), 0);
+}
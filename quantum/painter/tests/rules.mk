@@ -0,0 +1,54 @@
+qp_benchmark_DEFS := \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS=1 \
+	-DQUANTUM_PAINTER_DISPLAY_TIMEOUT=0 \
+	-DEEPROM_TEST_HARNESS
+qp_benchmark_SRC := \
+	platforms/test/timer.c \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_internal.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_command_list.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(QUANTUM_PATH)/painter/tests/qp_benchmark_assets.c \
+	$(QUANTUM_PATH)/painter/tests/qp_benchmark.cpp
+qp_benchmark_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic
+
+qp_prepared_text_DEFS := $(qp_benchmark_DEFS)
+qp_prepared_text_SRC := \
+	$(filter-out %/qp_benchmark.cpp,$(qp_benchmark_SRC)) \
+	$(QUANTUM_PATH)/painter/tests/qp_prepared_text_tests.cpp
+qp_prepared_text_INC := $(qp_benchmark_INC)
+
+qp_command_list_DEFS := \
+	$(qp_benchmark_DEFS) \
+	-DQUANTUM_PAINTER_COMMAND_LIST_SIZE=65535
+qp_command_list_SRC := \
+	$(filter-out %/qp_benchmark.cpp,$(qp_benchmark_SRC)) \
+	$(QUANTUM_PATH)/painter/tests/qp_command_list_tests.cpp
+qp_command_list_INC := $(qp_benchmark_INC)
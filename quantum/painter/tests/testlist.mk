@@ -0,0 +1,4 @@
+TEST_LIST += \
+	qp_benchmark \
+	qp_prepared_text \
+	qp_command_list
@@ -72,6 +72,14 @@
 #    include "process_unicode_common.h"
 #endif
 
+#if defined(EEPROM_DRIVER) && defined(EEPROM_ASYNC_ENABLE)
+#    include "eeprom_driver.h"
+#endif
+
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -198,6 +206,12 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#if defined(EEPROM_DRIVER) && defined(EEPROM_ASYNC_ENABLE)
+    eeprom_driver_flush();
+#endif
+#ifdef WEAR_LEVELING_ENABLE
+    wear_leveling_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -511,6 +525,14 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+#if defined(EEPROM_DRIVER) && defined(EEPROM_ASYNC_ENABLE)
+    // Persist any queued writes, in case power is removed while suspended
+    eeprom_driver_flush();
+#endif
+#ifdef WEAR_LEVELING_ENABLE
+    // Persist any pending writes, in case power is removed while suspended
+    wear_leveling_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
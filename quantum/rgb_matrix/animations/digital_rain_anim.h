@@ -9,10 +9,12 @@ RGB_MATRIX_EFFECT(DIGITAL_RAIN)
 
 bool DIGITAL_RAIN(effect_params_t* params) {
     // algorithm ported from https://github.com/tremby/Kaleidoscope-LEDEffect-DigitalRain
+    // intensities are in framebuffer units, brightness is applied when converting to a colour
     const uint8_t drop_ticks           = 28;
-    const uint8_t pure_green_intensity = (((uint16_t)rgb_matrix_config.hsv.v) * 3) >> 2;
-    const uint8_t max_brightness_boost = (((uint16_t)rgb_matrix_config.hsv.v) * 3) >> 2;
-    const uint8_t max_intensity        = rgb_matrix_config.hsv.v;
+    const uint8_t brightness           = rgb_matrix_config.hsv.v;
+    const uint8_t max_intensity        = RGB_MATRIX_FRAMEBUFFER_MAX == UINT8_MAX ? brightness : RGB_MATRIX_FRAMEBUFFER_MAX;
+    const uint8_t pure_green_intensity = (((uint16_t)max_intensity) * 3) >> 2;
+    const uint8_t max_brightness_boost = (((uint16_t)brightness) * 3) >> 2;
     const uint8_t decay_ticks          = 0xff / max_intensity;
 
     static uint8_t drop  = 0;
@@ -20,21 +22,23 @@ bool DIGITAL_RAIN(effect_params_t* params) {
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
-        memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+        rgb_matrix_framebuffer_clear();
         drop = 0;
     }
 
     decay++;
     for (uint8_t col = 0; col < MATRIX_COLS; col++) {
         for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            uint8_t intensity = rgb_matrix_framebuffer_get(row, col);
             if (row == 0 && drop == 0 && rand() < RAND_MAX / RGB_DIGITAL_RAIN_DROPS) {
                 // top row, pixels have just fallen and we're
                 // making a new rain drop in this column
-                g_rgb_frame_buffer[row][col] = max_intensity;
-            } else if (g_rgb_frame_buffer[row][col] > 0 && g_rgb_frame_buffer[row][col] < max_intensity) {
+                intensity = max_intensity;
+                rgb_matrix_framebuffer_set(row, col, intensity);
+            } else if (intensity > 0 && intensity < max_intensity) {
                 // neither fully bright nor dark, decay it
                 if (decay == decay_ticks) {
-                    g_rgb_frame_buffer[row][col]--;
+                    rgb_matrix_framebuffer_set(row, col, --intensity);
                 }
             }
             // set the pixel colour
@@ -43,11 +47,11 @@ bool DIGITAL_RAIN(effect_params_t* params) {
 
             // TODO: multiple leds are supported mapped to the same row/column
             if (led_count > 0) {
-                if (g_rgb_frame_buffer[row][col] > pure_green_intensity) {
-                    const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (g_rgb_frame_buffer[row][col] - pure_green_intensity) / (max_intensity - pure_green_intensity));
-                    rgb_matrix_set_color(led[0], boost, max_intensity, boost);
+                if (intensity > pure_green_intensity) {
+                    const uint8_t boost = (uint8_t)((uint16_t)max_brightness_boost * (intensity - pure_green_intensity) / (max_intensity - pure_green_intensity));
+                    rgb_matrix_set_color(led[0], boost, brightness, boost);
                 } else {
-                    const uint8_t green = (uint8_t)((uint16_t)max_intensity * g_rgb_frame_buffer[row][col] / pure_green_intensity);
+                    const uint8_t green = (uint8_t)((uint16_t)brightness * intensity / pure_green_intensity);
                     rgb_matrix_set_color(led[0], 0, green, 0);
                 }
             }
@@ -63,15 +67,15 @@ bool DIGITAL_RAIN(effect_params_t* params) {
         for (uint8_t row = MATRIX_ROWS - 1; row > 0; row--) {
             for (uint8_t col = 0; col < MATRIX_COLS; col++) {
                 // if ths is on the bottom row and bright allow decay
-                if (row == MATRIX_ROWS - 1 && g_rgb_frame_buffer[row][col] == max_intensity) {
-                    g_rgb_frame_buffer[row][col]--;
+                if (row == MATRIX_ROWS - 1 && rgb_matrix_framebuffer_get(row, col) == max_intensity) {
+                    rgb_matrix_framebuffer_set(row, col, max_intensity - 1);
                 }
                 // check if the pixel above is bright
-                if (g_rgb_frame_buffer[row - 1][col] >= max_intensity) { // Note: can be larger than max_intensity if val was recently decreased
+                if (rgb_matrix_framebuffer_get(row - 1, col) >= max_intensity) { // Note: can be larger than max_intensity if val was recently decreased
                     // allow old bright pixel to decay
-                    g_rgb_frame_buffer[row - 1][col] = max_intensity - 1;
+                    rgb_matrix_framebuffer_set(row - 1, col, max_intensity - 1);
                     // make this pixel bright
-                    g_rgb_frame_buffer[row][col] = max_intensity;
+                    rgb_matrix_framebuffer_set(row, col, max_intensity);
                 }
             }
         }
@@ -19,7 +19,7 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    rgb_matrix_framebuffer_set(row, col, qadd8(rgb_matrix_framebuffer_get(row, col), RGB_MATRIX_FRAMEBUFFER_SCALE(RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP)));
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
@@ -30,7 +30,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                rgb_matrix_framebuffer_set(row, col, qadd8(rgb_matrix_framebuffer_get(row, col), RGB_MATRIX_FRAMEBUFFER_SCALE(RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP)));
             } else {
 #            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
                 uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
@@ -40,7 +40,7 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
                     if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
                         amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
                     }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
+                    rgb_matrix_framebuffer_set(i_row, i_col, qadd8(rgb_matrix_framebuffer_get(i_row, i_col), RGB_MATRIX_FRAMEBUFFER_SCALE(amount)));
                 }
             }
         }
@@ -50,45 +50,37 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 
 // A timer to track the last time we decremented all heatmap values.
 static uint16_t heatmap_decrease_timer;
-// Whether we should decrement the heatmap values during the next update.
-static bool decrease_heatmap_values;
 
 bool TYPING_HEATMAP(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
-        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        rgb_matrix_framebuffer_clear();
     }
 
     // The heatmap animation might run in several iterations depending on
     // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
-    // timer when the animation starts.
-    if (params->iter == 0) {
-        decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
-
-        // Restart the timer if we are going to decrease the heatmap this frame.
-        if (decrease_heatmap_values) {
-            heatmap_decrease_timer = timer_read();
-        }
+    // timer and decrease the heatmap when the animation starts.
+    // A packed framebuffer step spans several 8-bit steps, so the delay is
+    // scaled to keep the same fade time.
+    if (params->iter == 0 && timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS * (UINT8_MAX / RGB_MATRIX_FRAMEBUFFER_MAX)) {
+        heatmap_decrease_timer = timer_read();
+        rgb_matrix_framebuffer_decay();
     }
 
-    // Render heatmap & decrease
+    // Render heatmap
     uint8_t count = 0;
     for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
-                uint8_t val = g_rgb_frame_buffer[row][col];
+                uint8_t val = rgb_matrix_framebuffer_get(row, col) * (UINT8_MAX / RGB_MATRIX_FRAMEBUFFER_MAX);
                 if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
 
                 HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
                 RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
                 rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-                }
             }
         }
     }
@@ -64,19 +64,35 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
 rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
 uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#    ifdef RGB_MATRIX_FRAMEBUFFER_PACKED
+uint32_t g_rgb_frame_buffer[RGB_MATRIX_FRAMEBUFFER_WORDS]                      = {0};
+uint8_t  g_rgb_frame_buffer_active[(RGB_MATRIX_FRAMEBUFFER_WORDS + 7) / 8] = {0};
+#    else
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+#    endif
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_COMPOSITOR
+uint8_t g_rgb_occlusion_mask[(RGB_MATRIX_LED_COUNT + 7) / 8] = {0};
+#endif // RGB_MATRIX_COMPOSITOR
 
 // internals
 static bool            suspend_state     = false;
+static bool            driver_asleep     = false;
 static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+#ifdef RGB_MATRIX_TARGET_FPS
+// frame pacing
+static uint32_t                 rgb_frame_tick  = 0;
+static uint32_t                 rgb_frame_start = 0;
+static rgb_matrix_frame_stats_t rgb_frame_stats = {0};
+#endif // RGB_MATRIX_TARGET_FPS
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -88,6 +104,21 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_COMPOSITOR
+typedef struct PACKED {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+} rgb_layer_pixel_t;
+
+// compositor layers, effects render into the base layer and indicators into the overlays
+static RGB               rgb_base_layer[RGB_MATRIX_LED_COUNT];
+static rgb_layer_pixel_t rgb_overlay_layers[RGB_MATRIX_COMPOSITOR_LAYERS][RGB_MATRIX_LED_COUNT];
+// 0 targets the base layer, otherwise the overlay layer (n - 1)
+static uint8_t rgb_target_layer = 0;
+#endif // RGB_MATRIX_COMPOSITOR
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, EECONFIG_RGB_MATRIX, rgb_matrix_config);
 
 void eeconfig_update_rgb_matrix(void) {
@@ -139,16 +170,94 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+#ifdef RGB_MATRIX_COMPOSITOR
+static void rgb_compositor_get_range(uint8_t *led_min, uint8_t *led_max) {
+    *led_min = 0;
+    *led_max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        *led_max = k_rgb_matrix_split[0];
+    } else {
+        *led_min = k_rgb_matrix_split[0];
+    }
+#    endif
+}
+
+static void rgb_compositor_blend(void) {
+    uint8_t led_min, led_max;
+    rgb_compositor_get_range(&led_min, &led_max);
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        uint8_t r        = rgb_base_layer[i].r;
+        uint8_t g        = rgb_base_layer[i].g;
+        uint8_t b        = rgb_base_layer[i].b;
+        bool    occluded = false;
+        for (uint8_t layer = 0; layer < RGB_MATRIX_COMPOSITOR_LAYERS; layer++) {
+            rgb_layer_pixel_t *pixel = &rgb_overlay_layers[layer][i];
+            if (pixel->a == 0) {
+                continue;
+            }
+            if (pixel->a == UINT8_MAX) {
+                r        = pixel->r;
+                g        = pixel->g;
+                b        = pixel->b;
+                occluded = true;
+            } else {
+                r = lerp8by8(r, pixel->r, pixel->a);
+                g = lerp8by8(g, pixel->g, pixel->a);
+                b = lerp8by8(b, pixel->b, pixel->a);
+            }
+        }
+
+        // remember fully covered LEDs so effects can skip them next frame
+        if (occluded) {
+            g_rgb_occlusion_mask[i / 8] |= (1 << (i % 8));
+        } else {
+            g_rgb_occlusion_mask[i / 8] &= ~(1 << (i % 8));
+        }
+
+        rgb_matrix_driver.set_color(i, r, g, b);
+    }
+}
+
+void rgb_matrix_layer_set_color(uint8_t layer, int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
+    if (layer >= RGB_MATRIX_COMPOSITOR_LAYERS || index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    rgb_overlay_layers[layer][index] = (rgb_layer_pixel_t){.r = red, .g = green, .b = blue, .a = alpha};
+}
+
+void rgb_matrix_layer_clear(uint8_t layer) {
+    if (layer >= RGB_MATRIX_COMPOSITOR_LAYERS) {
+        return;
+    }
+    memset(rgb_overlay_layers[layer], 0, sizeof(rgb_overlay_layers[layer]));
+}
+#endif // RGB_MATRIX_COMPOSITOR
+
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_COMPOSITOR
+    rgb_compositor_blend();
+#endif // RGB_MATRIX_COMPOSITOR
     rgb_matrix_driver.flush();
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_COMPOSITOR
+    if (rgb_target_layer) {
+        rgb_matrix_layer_set_color(rgb_target_layer - 1, index, red, green, blue, UINT8_MAX);
+    } else if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        rgb_base_layer[index].r = red;
+        rgb_base_layer[index].g = green;
+        rgb_base_layer[index].b = blue;
+    }
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif // RGB_MATRIX_COMPOSITOR
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) || defined(RGB_MATRIX_COMPOSITOR)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -156,6 +265,44 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+#ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+void rgb_matrix_framebuffer_clear(void) {
+    memset(g_rgb_frame_buffer, 0, sizeof(g_rgb_frame_buffer));
+#    ifdef RGB_MATRIX_FRAMEBUFFER_PACKED
+    memset(g_rgb_frame_buffer_active, 0, sizeof(g_rgb_frame_buffer_active));
+#    endif
+}
+
+void rgb_matrix_framebuffer_decay(void) {
+#    ifdef RGB_MATRIX_FRAMEBUFFER_PACKED
+    // only visit words flagged as active, eight cells at a time
+    for (uint8_t i = 0; i < sizeof(g_rgb_frame_buffer_active); i++) {
+        uint8_t active = g_rgb_frame_buffer_active[i];
+        for (uint8_t bit = 0; active; bit++, active >>= 1) {
+            if (!(active & 1)) continue;
+
+            uint16_t index = i * 8 + bit;
+            uint32_t word  = g_rgb_frame_buffer[index];
+            // the lowest bit of every non-zero nibble, so the subtraction never borrows across cells
+            word -= (word | (word >> 1) | (word >> 2) | (word >> 3)) & 0x11111111;
+            g_rgb_frame_buffer[index] = word;
+            if (!word) {
+                g_rgb_frame_buffer_active[i] &= ~(1 << bit);
+            }
+        }
+    }
+#    else
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (g_rgb_frame_buffer[row][col]) {
+                g_rgb_frame_buffer[row][col]--;
+            }
+        }
+    }
+#    endif
+}
+#endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -175,10 +322,10 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
     }
 
     if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
+        memmove(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
+        memmove(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
+        memmove(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
+        memmove(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
         last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
     }
 
@@ -258,15 +405,44 @@ static void rgb_task_timers(void) {
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef RGB_MATRIX_TARGET_FPS
+static void rgb_task_next_frame(void) {
+    uint32_t now = sync_timer_read32();
+    rgb_frame_tick += RGB_MATRIX_FRAME_PERIOD;
+    // drop every frame slot the previous frame overran, rather than bunching them up
+    if (timer_expired32(now, rgb_frame_tick)) {
+        uint32_t missed = (now - rgb_frame_tick) / RGB_MATRIX_FRAME_PERIOD + 1;
+        rgb_frame_stats.skipped += missed;
+        rgb_frame_tick += missed * RGB_MATRIX_FRAME_PERIOD;
+    }
+}
+
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void) {
+    return rgb_frame_stats;
+}
+
+void rgb_matrix_reset_frame_stats(void) {
+    memset(&rgb_frame_stats, 0, sizeof(rgb_frame_stats));
+}
+#endif // RGB_MATRIX_TARGET_FPS
+
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
+#ifdef RGB_MATRIX_TARGET_FPS
+    // render ahead as soon as the previous frame slot has been presented
+    if (timer_expired32(sync_timer_read32(), rgb_frame_tick - RGB_MATRIX_FRAME_PERIOD)) rgb_task_state = STARTING;
+#else
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
+#endif // RGB_MATRIX_TARGET_FPS
 }
 
 static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
+#ifdef RGB_MATRIX_TARGET_FPS
+    rgb_frame_start = sync_timer_read32();
+#endif // RGB_MATRIX_TARGET_FPS
 
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
@@ -334,34 +510,114 @@ static void rgb_task_render(uint8_t effect) {
         if (!rgb_effect_params.init && effect == RGB_MATRIX_NONE) {
             // We only need to flush once if we are RGB_MATRIX_NONE
             rgb_task_state = SYNCING;
+#ifdef RGB_MATRIX_TARGET_FPS
+            rgb_task_next_frame();
+#endif // RGB_MATRIX_TARGET_FPS
+        }
+#ifdef RGB_MATRIX_TARGET_FPS
+        rgb_frame_stats.render_time = sync_timer_elapsed32(rgb_frame_start);
+        if (rgb_frame_stats.render_time > rgb_frame_stats.max_render_time) {
+            rgb_frame_stats.max_render_time = rgb_frame_stats.render_time;
         }
+#endif // RGB_MATRIX_TARGET_FPS
     }
 }
 
+#ifdef RGB_MATRIX_COMPOSITOR
+static void rgb_task_indicators(uint8_t effect) {
+    for (uint8_t layer = 0; layer < RGB_MATRIX_COMPOSITOR_LAYERS; layer++) {
+        rgb_matrix_layer_clear(layer);
+    }
+    if (!effect) {
+        return;
+    }
+
+    // indicators are drawn once per frame over the whole range, rgb_matrix_set_color
+    // calls made from the callbacks land on the first overlay layer
+    uint8_t led_min, led_max;
+    rgb_compositor_get_range(&led_min, &led_max);
+    rgb_target_layer = 1;
+    rgb_matrix_indicators();
+    rgb_matrix_indicators_advanced_kb(led_min, led_max);
+    rgb_target_layer = 0;
+}
+#endif // RGB_MATRIX_COMPOSITOR
+
 static void rgb_task_flush(uint8_t effect) {
     // update last trackers after the first full render so we can init over several frames
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_COMPOSITOR
+    rgb_task_indicators(effect);
+#endif // RGB_MATRIX_COMPOSITOR
+
+#ifdef RGB_MATRIX_TARGET_FPS
+    uint32_t flush_start = sync_timer_read32();
+#endif // RGB_MATRIX_TARGET_FPS
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
+#ifdef RGB_MATRIX_TARGET_FPS
+    rgb_frame_stats.frames++;
+    rgb_frame_stats.flush_time = sync_timer_elapsed32(flush_start);
+    if (rgb_frame_stats.flush_time > rgb_frame_stats.max_flush_time) {
+        rgb_frame_stats.max_flush_time = rgb_frame_stats.flush_time;
+    }
+    rgb_task_next_frame();
+#endif // RGB_MATRIX_TARGET_FPS
+
     // next task
     rgb_task_state = SYNCING;
 }
 
+static void rgb_task_sleep(void) {
+    // blank the LEDs once, then let the driver power down
+    rgb_task_render(0);
+    rgb_task_flush(0);
+    if (rgb_matrix_driver.sleep) {
+        rgb_matrix_driver.sleep();
+    }
+    driver_asleep = true;
+}
+
+static void rgb_task_wake(void) {
+    if (rgb_matrix_driver.wake) {
+        rgb_matrix_driver.wake();
+    }
+    driver_asleep = false;
+
+    // force the current effect to initialise again and redraw every LED
+    rgb_last_effect = UINT8_MAX;
+    rgb_task_state  = STARTING;
+#ifdef RGB_MATRIX_TARGET_FPS
+    // restart the cadence, the time spent asleep is not skipped frames
+    rgb_frame_tick = sync_timer_read32();
+#endif // RGB_MATRIX_TARGET_FPS
+}
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
-    // Ideally we would also stop sending zeros to the LED driver PWM buffers
-    // while suspended and just do a software shutdown. This is a cheap hack for now.
     bool suspend_backlight = suspend_state ||
 #if RGB_MATRIX_TIMEOUT > 0
                              (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
 #endif // RGB_MATRIX_TIMEOUT > 0
                              false;
 
-    uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
+    // the render/flush state machine stops entirely while the driver is asleep
+    if (suspend_backlight) {
+        if (!driver_asleep) {
+            rgb_task_sleep();
+        }
+        eeconfig_flush_rgb_matrix(false);
+        return;
+    } else if (driver_asleep) {
+        rgb_task_wake();
+    }
+
+    uint8_t effect = !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
 
     switch (rgb_task_state) {
         case STARTING:
@@ -369,14 +625,20 @@ void rgb_matrix_task(void) {
             break;
         case RENDERING:
             rgb_task_render(effect);
+#ifndef RGB_MATRIX_COMPOSITOR
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+#endif // RGB_MATRIX_COMPOSITOR
             break;
         case FLUSHING:
+#ifdef RGB_MATRIX_TARGET_FPS
+            // hold the finished frame until its slot so flushes land on a steady cadence
+            if (!timer_expired32(sync_timer_read32(), rgb_frame_tick)) break;
+#endif // RGB_MATRIX_TARGET_FPS
             rgb_task_flush(effect);
             break;
         case SYNCING:
@@ -448,6 +710,10 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_TARGET_FPS
+    rgb_frame_tick = sync_timer_read32();
+#endif // RGB_MATRIX_TARGET_FPS
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -470,10 +736,15 @@ void rgb_matrix_init(void) {
 
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
-    if (state && !suspend_state) { // only run if turning off, and only once
-        rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+    if (state && !suspend_state && !driver_asleep) { // only run if turning off, and only once
+        rgb_task_sleep();                            // turn off all LEDs and shut the driver down
     }
+#    ifdef RGB_MATRIX_TARGET_FPS
+    if (!state && suspend_state) {
+        // don't count the time spent suspended as dropped frames
+        rgb_frame_tick = sync_timer_read32();
+    }
+#    endif
     suspend_state = state;
 #endif
 }
@@ -90,6 +90,18 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifdef RGB_MATRIX_TARGET_FPS
+#    if RGB_MATRIX_TARGET_FPS < 1 || RGB_MATRIX_TARGET_FPS > 1000
+#        error "RGB_MATRIX_TARGET_FPS must be between 1 and 1000"
+#    endif
+// Rounded up, so that the target is never exceeded
+#    define RGB_MATRIX_FRAME_PERIOD ((1000 + RGB_MATRIX_TARGET_FPS - 1) / RGB_MATRIX_TARGET_FPS)
+#endif
+
+#if defined(RGB_MATRIX_COMPOSITOR) && !defined(RGB_MATRIX_COMPOSITOR_LAYERS)
+#    define RGB_MATRIX_COMPOSITOR_LAYERS 1
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -111,8 +123,13 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
         rgb_matrix_set_color(i, r, g, b);          \
     }
 
-#define RGB_MATRIX_TEST_LED_FLAGS() \
-    if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+#ifdef RGB_MATRIX_COMPOSITOR
+#    define RGB_MATRIX_TEST_LED_FLAGS() \
+        if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags) || rgb_matrix_is_led_occluded(i)) continue
+#else
+#    define RGB_MATRIX_TEST_LED_FLAGS() \
+        if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+#endif
 
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
@@ -150,8 +167,19 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
+#ifdef RGB_MATRIX_COMPOSITOR
+// Overlay layers are blended over the effect output in ascending order on flush
+void rgb_matrix_layer_set_color(uint8_t layer, int index, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha);
+void rgb_matrix_layer_clear(uint8_t layer);
+#endif
+
 void rgb_matrix_task(void);
 
+#ifdef RGB_MATRIX_TARGET_FPS
+rgb_matrix_frame_stats_t rgb_matrix_get_frame_stats(void);
+void                     rgb_matrix_reset_frame_stats(void);
+#endif
+
 // This runs after another backlight effect and replaces
 // colors already set
 void rgb_matrix_indicators(void);
@@ -269,11 +297,56 @@ static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
 
 extern rgb_config_t rgb_matrix_config;
 
+#ifdef RGB_MATRIX_COMPOSITOR
+extern uint8_t g_rgb_occlusion_mask[(RGB_MATRIX_LED_COUNT + 7) / 8];
+
+static inline bool rgb_matrix_is_led_occluded(uint8_t led_idx) {
+    return g_rgb_occlusion_mask[led_idx / 8] & (1 << (led_idx % 8));
+}
+#endif
+
 extern uint32_t     g_rgb_timer;
 extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#    ifdef RGB_MATRIX_FRAMEBUFFER_PACKED
+// 4-bit cells, eight to a word, with one bit per word flagging it may hold non-zero cells
+#        define RGB_MATRIX_FRAMEBUFFER_MAX 15
+#        define RGB_MATRIX_FRAMEBUFFER_WORDS ((MATRIX_ROWS * MATRIX_COLS + 7) / 8)
+extern uint32_t g_rgb_frame_buffer[RGB_MATRIX_FRAMEBUFFER_WORDS];
+extern uint8_t  g_rgb_frame_buffer_active[(RGB_MATRIX_FRAMEBUFFER_WORDS + 7) / 8];
+
+static inline uint8_t rgb_matrix_framebuffer_get(uint8_t row, uint8_t col) {
+    uint16_t cell = (uint16_t)row * MATRIX_COLS + col;
+    return (g_rgb_frame_buffer[cell / 8] >> ((cell % 8) * 4)) & 0x0F;
+}
+
+static inline void rgb_matrix_framebuffer_set(uint8_t row, uint8_t col, uint8_t val) {
+    uint16_t cell  = (uint16_t)row * MATRIX_COLS + col;
+    uint8_t  shift = (cell % 8) * 4;
+    if (val > RGB_MATRIX_FRAMEBUFFER_MAX) val = RGB_MATRIX_FRAMEBUFFER_MAX;
+    g_rgb_frame_buffer[cell / 8] = (g_rgb_frame_buffer[cell / 8] & ~((uint32_t)0x0F << shift)) | ((uint32_t)val << shift);
+    if (val) g_rgb_frame_buffer_active[cell / 64] |= (1 << ((cell / 8) % 8));
+}
+#    else
+#        define RGB_MATRIX_FRAMEBUFFER_MAX UINT8_MAX
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
+
+static inline uint8_t rgb_matrix_framebuffer_get(uint8_t row, uint8_t col) {
+    return g_rgb_frame_buffer[row][col];
+}
+
+static inline void rgb_matrix_framebuffer_set(uint8_t row, uint8_t col, uint8_t val) {
+    g_rgb_frame_buffer[row][col] = val;
+}
+#    endif
+
+// Converts an 8-bit amount to framebuffer units
+#    define RGB_MATRIX_FRAMEBUFFER_SCALE(val) ((uint8_t)(((uint16_t)(val)*RGB_MATRIX_FRAMEBUFFER_MAX + UINT8_MAX / 2) / UINT8_MAX))
+
+void rgb_matrix_framebuffer_clear(void);
+// Decrements every non-zero framebuffer cell by one
+void rgb_matrix_framebuffer_decay(void);
 #endif
@@ -23,7 +23,7 @@
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
- * All members must be provided.
+ * All members must be provided, except for sleep and wake which are optional.
  * Keyboard custom drivers can define this in their own files, it should only
  * be here if shared between boards.
  */
@@ -45,99 +45,269 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 };
 
 #elif defined(RGB_MATRIX_IS31FL3729)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3729_DRIVER_COUNT; i++) {
+        is31fl3729_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3729_DRIVER_COUNT; i++) {
+        is31fl3729_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3729_init_drivers,
     .flush         = is31fl3729_flush,
     .set_color     = is31fl3729_set_color,
     .set_color_all = is31fl3729_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3731)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3731_DRIVER_COUNT; i++) {
+        is31fl3731_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3731_DRIVER_COUNT; i++) {
+        is31fl3731_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3731_init_drivers,
     .flush         = is31fl3731_flush,
     .set_color     = is31fl3731_set_color,
     .set_color_all = is31fl3731_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3733)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3733_DRIVER_COUNT; i++) {
+        is31fl3733_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3733_DRIVER_COUNT; i++) {
+        is31fl3733_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3733_init_drivers,
     .flush         = is31fl3733_flush,
     .set_color     = is31fl3733_set_color,
     .set_color_all = is31fl3733_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3736)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3736_DRIVER_COUNT; i++) {
+        is31fl3736_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3736_DRIVER_COUNT; i++) {
+        is31fl3736_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3736_init_drivers,
     .flush         = is31fl3736_flush,
     .set_color     = is31fl3736_set_color,
     .set_color_all = is31fl3736_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3737)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3737_DRIVER_COUNT; i++) {
+        is31fl3737_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3737_DRIVER_COUNT; i++) {
+        is31fl3737_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3737_init_drivers,
     .flush         = is31fl3737_flush,
     .set_color     = is31fl3737_set_color,
     .set_color_all = is31fl3737_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3741)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3741_DRIVER_COUNT; i++) {
+        is31fl3741_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3741_DRIVER_COUNT; i++) {
+        is31fl3741_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3741_init_drivers,
     .flush         = is31fl3741_flush,
     .set_color     = is31fl3741_set_color,
     .set_color_all = is31fl3741_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3742A)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3742A_DRIVER_COUNT; i++) {
+        is31fl3742a_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3742A_DRIVER_COUNT; i++) {
+        is31fl3742a_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3742a_init_drivers,
     .flush         = is31fl3742a_flush,
     .set_color     = is31fl3742a_set_color,
     .set_color_all = is31fl3742a_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3743A)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3743A_DRIVER_COUNT; i++) {
+        is31fl3743a_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3743A_DRIVER_COUNT; i++) {
+        is31fl3743a_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3743a_init_drivers,
     .flush         = is31fl3743a_flush,
     .set_color     = is31fl3743a_set_color,
     .set_color_all = is31fl3743a_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3745)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3745_DRIVER_COUNT; i++) {
+        is31fl3745_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3745_DRIVER_COUNT; i++) {
+        is31fl3745_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3745_init_drivers,
     .flush         = is31fl3745_flush,
     .set_color     = is31fl3745_set_color,
     .set_color_all = is31fl3745_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_IS31FL3746A)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < IS31FL3746A_DRIVER_COUNT; i++) {
+        is31fl3746a_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < IS31FL3746A_DRIVER_COUNT; i++) {
+        is31fl3746a_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = is31fl3746a_init_drivers,
     .flush         = is31fl3746a_flush,
     .set_color     = is31fl3746a_set_color,
     .set_color_all = is31fl3746a_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_SNLED27351)
+static void sw_shutdown_all(void) {
+    for (uint8_t i = 0; i < SNLED27351_DRIVER_COUNT; i++) {
+        snled27351_sw_shutdown(i);
+    }
+}
+
+static void sw_return_normal_all(void) {
+    for (uint8_t i = 0; i < SNLED27351_DRIVER_COUNT; i++) {
+        snled27351_sw_return_normal(i);
+    }
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = snled27351_init_drivers,
     .flush         = snled27351_flush,
     .set_color     = snled27351_set_color,
     .set_color_all = snled27351_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_AW20216S)
+static void sw_shutdown_all(void) {
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_1);
+#    if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_shutdown(AW20216S_CS_PIN_2);
+#    endif
+}
+
+static void sw_return_normal_all(void) {
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_1);
+#    if defined(AW20216S_CS_PIN_2)
+    aw20216s_sw_return_normal(AW20216S_CS_PIN_2);
+#    endif
+}
+
 const rgb_matrix_driver_t rgb_matrix_driver = {
     .init          = aw20216s_init_drivers,
     .flush         = aw20216s_flush,
     .set_color     = aw20216s_set_color,
     .set_color_all = aw20216s_set_color_all,
+    .sleep         = sw_shutdown_all,
+    .wake          = sw_return_normal_all,
 };
 
 #elif defined(RGB_MATRIX_WS2812)
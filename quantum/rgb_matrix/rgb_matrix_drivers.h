@@ -46,6 +46,10 @@ typedef struct {
     void (*set_color_all)(uint8_t r, uint8_t g, uint8_t b);
     /* Flush any buffered changes to the hardware. */
     void (*flush)(void);
+    /* Put the hardware into its low power state, keeping the buffered state. Optional. */
+    void (*sleep)(void);
+    /* Bring the hardware back out of its low power state. Optional. */
+    void (*wake)(void);
 } rgb_matrix_driver_t;
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
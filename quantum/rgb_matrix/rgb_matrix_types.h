@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -42,6 +46,15 @@ typedef struct PACKED {
 
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
+typedef struct {
+    uint32_t frames;          // frames flushed to the driver
+    uint32_t skipped;         // frame slots dropped because the previous frame overran
+    uint16_t render_time;     // ms from the start of the last frame until it was ready to flush
+    uint16_t max_render_time; // worst render_time seen
+    uint16_t flush_time;      // ms spent in the last driver flush
+    uint16_t max_flush_time;  // worst flush_time seen
+} rgb_matrix_frame_stats_t;
+
 typedef uint8_t led_flags_t;
 
 typedef struct PACKED {
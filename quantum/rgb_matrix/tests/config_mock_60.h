@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+#include "config_rgb_matrix_common.h"
+
+#define MATRIX_ROWS 5
+#define MATRIX_COLS 12
+
+#define RGB_MATRIX_LED_COUNT 60
@@ -0,0 +1,81 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+#include "mock_driver.h"
+#include <stdlib.h>
+#include <string.h>
+
+RGB      mock_led_buffer[RGB_MATRIX_LED_COUNT];
+uint32_t mock_flush_count = 0;
+
+led_config_t g_led_config;
+
+void mock_led_config_init(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t index = row * MATRIX_COLS + col;
+            if (index >= RGB_MATRIX_LED_COUNT) {
+                g_led_config.matrix_co[row][col] = NO_LED;
+                continue;
+            }
+
+            g_led_config.matrix_co[row][col] = index;
+            g_led_config.point[index].x      = col * 224 / (MATRIX_COLS - 1);
+            g_led_config.point[index].y      = row * 64 / (MATRIX_ROWS - 1);
+            g_led_config.flags[index]        = (col == 0 || col == MATRIX_COLS - 1) ? LED_FLAG_MODIFIER : LED_FLAG_KEYLIGHT;
+        }
+    }
+}
+
+static void mock_init(void) {
+    memset(mock_led_buffer, 0, sizeof(mock_led_buffer));
+    mock_flush_count = 0;
+}
+
+static void mock_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    // Real drivers drop out of range indices, which some effects rely on for NO_LED
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) return;
+
+    mock_led_buffer[index].r = r;
+    mock_led_buffer[index].g = g;
+    mock_led_buffer[index].b = b;
+}
+
+static void mock_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        mock_set_color(i, r, g, b);
+    }
+}
+
+static void mock_flush(void) {
+    mock_flush_count++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = mock_init,
+    .flush         = mock_flush,
+    .set_color     = mock_set_color,
+    .set_color_all = mock_set_color_all,
+};
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+bool is_keyboard_left(void) {
+    return true;
+}
+
+// Several effects use rand(), so supply a fixed generator to keep golden frames independent of the host libc.
+// Effects compare against RAND_MAX, so the output is scaled to cover the full 0..RAND_MAX range.
+static uint64_t mock_rand_state = 1;
+
+void srand(unsigned int seed) {
+    mock_rand_state = seed;
+}
+
+int rand(void) {
+    mock_rand_state = mock_rand_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (int)(((mock_rand_state >> 33) * ((uint64_t)RAND_MAX + 1)) >> 31);
+}
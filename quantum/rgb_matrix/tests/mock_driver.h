@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+extern RGB      mock_led_buffer[RGB_MATRIX_LED_COUNT];
+extern uint32_t mock_flush_count;
+
+/* Lays the LEDs out on an evenly spaced MATRIX_ROWS x MATRIX_COLS grid, leaving any trailing positions unassigned. */
+void mock_led_config_init(void);
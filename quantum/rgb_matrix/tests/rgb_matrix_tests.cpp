@@ -0,0 +1,268 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <chrono>
+#include <stdio.h>
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "fnv.h"
+#include "lib/lib8tion/lib8tion.h"
+#include "rgb_matrix/tests/mock_driver.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static const char *effect_names[] = {
+    "NONE",
+#define RGB_MATRIX_EFFECT(name, ...) #name,
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+// Frames rendered per effect, and the frames on which the synthetic key events land
+#define GOLDEN_FRAMES 48
+#define BENCHMARK_FRAMES 256
+
+static const struct {
+    uint8_t frame;
+    uint8_t row;
+    uint8_t col;
+    bool    pressed;
+} key_events[] = {
+    {4, 1, 1, true},
+    {6, 1, 1, false},
+    {10, MATRIX_ROWS / 2, MATRIX_COLS / 2, true},
+    {11, 0, MATRIX_COLS - 1, true},
+    {14, MATRIX_ROWS / 2, MATRIX_COLS / 2, false},
+    {15, 0, MATRIX_COLS - 1, false},
+    {24, MATRIX_ROWS - 1, 2, true},
+    {25, MATRIX_ROWS - 1, 2, false},
+};
+
+// FNV-1a over every flushed frame of each effect, indexed by effect. Regenerate when an effect is
+// intentionally changed by running the test and copying the reported values.
+#if RGB_MATRIX_LED_COUNT == 60
+static const uint32_t golden_hashes[RGB_MATRIX_EFFECT_MAX] = {
+    0x00000000, // NONE
+    0xC92B9A05, // SOLID_COLOR
+    0xFDCE3B45, // ALPHAS_MODS
+    0x37416505, // GRADIENT_UP_DOWN
+    0x2B261645, // GRADIENT_LEFT_RIGHT
+    0x4E2C5C05, // BREATHING
+    0x8ECBBA5D, // BAND_SAT
+    0xD169332D, // BAND_VAL
+    0x15DFD844, // BAND_PINWHEEL_SAT
+    0xD02954BF, // BAND_PINWHEEL_VAL
+    0x8F634F81, // BAND_SPIRAL_SAT
+    0xEEC314EA, // BAND_SPIRAL_VAL
+    0x25C26C9D, // CYCLE_ALL
+    0x04925A3D, // CYCLE_LEFT_RIGHT
+    0x45D5518D, // CYCLE_UP_DOWN
+    0x6232D277, // RAINBOW_MOVING_CHEVRON
+    0xE6DB9D7B, // CYCLE_OUT_IN
+    0x2DEF0433, // CYCLE_OUT_IN_DUAL
+    0x5CF15491, // CYCLE_PINWHEEL
+    0xAE9A4017, // CYCLE_SPIRAL
+    0x9DDFAFCD, // DUAL_BEACON
+    0x8643EB1D, // RAINBOW_BEACON
+    0xB66D8D13, // RAINBOW_PINWHEELS
+    0x6C75322D, // FLOWER_BLOOMING
+    0xD69F4C5D, // RAINDROPS
+    0x40B925B1, // JELLYBEAN_RAINDROPS
+    0xFA700B45, // HUE_BREATHING
+    0x37C47F9F, // HUE_PENDULUM
+    0x2D6F54CB, // HUE_WAVE
+    0x3B3926AD, // PIXEL_RAIN
+    0x1378B675, // PIXEL_FLOW
+    0x1B39F515, // PIXEL_FRACTAL
+    0x6F2D7B3B, // TYPING_HEATMAP
+    0xF348B8C5, // DIGITAL_RAIN
+    0xC4E33645, // SOLID_REACTIVE_SIMPLE
+    0x2AC9B82D, // SOLID_REACTIVE
+    0x9FE6FAF8, // SOLID_REACTIVE_WIDE
+    0x6B6E05EE, // SOLID_REACTIVE_MULTIWIDE
+    0xF044143D, // SOLID_REACTIVE_CROSS
+    0x4A1F333D, // SOLID_REACTIVE_MULTICROSS
+    0xFF151178, // SOLID_REACTIVE_NEXUS
+    0x60C3F243, // SOLID_REACTIVE_MULTINEXUS
+    0x1E02F7EF, // SPLASH
+    0x86E725BB, // MULTISPLASH
+    0x80A20D50, // SOLID_SPLASH
+    0x0A83B336, // SOLID_MULTISPLASH
+    0x0E1C59E7, // STARLIGHT
+    0xDDC3F798, // STARLIGHT_DUAL_SAT
+    0xA46538A3, // STARLIGHT_DUAL_HUE
+    0x6CB18365, // RIVERFLOW
+};
+#elif RGB_MATRIX_LED_COUNT == 100
+static const uint32_t golden_hashes[RGB_MATRIX_EFFECT_MAX] = {
+    0x00000000, // NONE
+    0xE7C69D85, // SOLID_COLOR
+    0xEDD38965, // ALPHAS_MODS
+    0xD726C5C5, // GRADIENT_UP_DOWN
+    0x39B14785, // GRADIENT_LEFT_RIGHT
+    0x8F9F4565, // BREATHING
+    0x454D2F29, // BAND_SAT
+    0x57C5C9C5, // BAND_VAL
+    0xA56D0810, // BAND_PINWHEEL_SAT
+    0xF6418E61, // BAND_PINWHEEL_VAL
+    0x3123A3F1, // BAND_SPIRAL_SAT
+    0x8829A547, // BAND_SPIRAL_VAL
+    0x3D5BA71D, // CYCLE_ALL
+    0x6FFA39BB, // CYCLE_LEFT_RIGHT
+    0xE92C64F1, // CYCLE_UP_DOWN
+    0xDC623F6F, // RAINBOW_MOVING_CHEVRON
+    0xDEC7B7E9, // CYCLE_OUT_IN
+    0x516397D9, // CYCLE_OUT_IN_DUAL
+    0xCF90F63B, // CYCLE_PINWHEEL
+    0x9AACCD87, // CYCLE_SPIRAL
+    0x43EEB7A7, // DUAL_BEACON
+    0x479104FD, // RAINBOW_BEACON
+    0x36A977CF, // RAINBOW_PINWHEELS
+    0xEBD35D69, // FLOWER_BLOOMING
+    0x0A19269F, // RAINDROPS
+    0x44D6FB38, // JELLYBEAN_RAINDROPS
+    0xFF061305, // HUE_BREATHING
+    0xA1C6CE47, // HUE_PENDULUM
+    0x999712E5, // HUE_WAVE
+    0x3456B71D, // PIXEL_RAIN
+    0x7CEB7185, // PIXEL_FLOW
+    0x5C34EC85, // PIXEL_FRACTAL
+    0xB6DB8D33, // TYPING_HEATMAP
+    0x3CA1CAC5, // DIGITAL_RAIN
+    0x569E6C05, // SOLID_REACTIVE_SIMPLE
+    0xA584561D, // SOLID_REACTIVE
+    0xFB1B2F10, // SOLID_REACTIVE_WIDE
+    0x27D20FA0, // SOLID_REACTIVE_MULTIWIDE
+    0xEA984483, // SOLID_REACTIVE_CROSS
+    0xEB7719E9, // SOLID_REACTIVE_MULTICROSS
+    0xDCCE82E1, // SOLID_REACTIVE_NEXUS
+    0x0702308B, // SOLID_REACTIVE_MULTINEXUS
+    0x259F5669, // SPLASH
+    0x7D188404, // MULTISPLASH
+    0xBE23F09C, // SOLID_SPLASH
+    0x90CB4A8B, // SOLID_MULTISPLASH
+    0xC4D48C03, // STARLIGHT
+    0xE1E23137, // STARLIGHT_DUAL_SAT
+    0xC2C514D6, // STARLIGHT_DUAL_HUE
+    0x49832348, // RIVERFLOW
+};
+#elif RGB_MATRIX_LED_COUNT == 150
+static const uint32_t golden_hashes[RGB_MATRIX_EFFECT_MAX] = {
+    0x00000000, // NONE
+    0x640EEF65, // SOLID_COLOR
+    0x4D2068C5, // ALPHAS_MODS
+    0x2A898DC5, // GRADIENT_UP_DOWN
+    0xCAD304C5, // GRADIENT_LEFT_RIGHT
+    0xBA1EB111, // BREATHING
+    0x4364C5CF, // BAND_SAT
+    0xDC6838C5, // BAND_VAL
+    0xE4832A51, // BAND_PINWHEEL_SAT
+    0x224F9431, // BAND_PINWHEEL_VAL
+    0x9F0AADBD, // BAND_SPIRAL_SAT
+    0x132D47A4, // BAND_SPIRAL_VAL
+    0x6189852D, // CYCLE_ALL
+    0x5301D677, // CYCLE_LEFT_RIGHT
+    0xF7EF227B, // CYCLE_UP_DOWN
+    0xD7CC28E5, // RAINBOW_MOVING_CHEVRON
+    0x89720A27, // CYCLE_OUT_IN
+    0xEE572359, // CYCLE_OUT_IN_DUAL
+    0x04C932E9, // CYCLE_PINWHEEL
+    0x370F6577, // CYCLE_SPIRAL
+    0xBFBAF8F9, // DUAL_BEACON
+    0x845B9881, // RAINBOW_BEACON
+    0xA9263EBF, // RAINBOW_PINWHEELS
+    0xF7DEC7DD, // FLOWER_BLOOMING
+    0x161B0FEF, // RAINDROPS
+    0x04385B69, // JELLYBEAN_RAINDROPS
+    0x02121D7D, // HUE_BREATHING
+    0xC2BDACEF, // HUE_PENDULUM
+    0x7318F2EF, // HUE_WAVE
+    0xF9DFCA0D, // PIXEL_RAIN
+    0x75528545, // PIXEL_FLOW
+    0x985C2045, // PIXEL_FRACTAL
+    0x030B2F27, // TYPING_HEATMAP
+    0xC5444145, // DIGITAL_RAIN
+    0x1C8F7105, // SOLID_REACTIVE_SIMPLE
+    0xF6774B05, // SOLID_REACTIVE
+    0x1634C6C7, // SOLID_REACTIVE_WIDE
+    0x3BF8EA2D, // SOLID_REACTIVE_MULTIWIDE
+    0xFD5F1663, // SOLID_REACTIVE_CROSS
+    0x3523617A, // SOLID_REACTIVE_MULTICROSS
+    0xE36F2C15, // SOLID_REACTIVE_NEXUS
+    0x5CB4397B, // SOLID_REACTIVE_MULTINEXUS
+    0x6C9D3210, // SPLASH
+    0x3F9D8FC3, // MULTISPLASH
+    0xA64ED8BF, // SOLID_SPLASH
+    0xC44F2963, // SOLID_MULTISPLASH
+    0x72437CFB, // STARLIGHT
+    0x21E7140C, // STARLIGHT_DUAL_SAT
+    0xBD1D41AA, // STARLIGHT_DUAL_HUE
+    0xC3D1BD1F, // RIVERFLOW
+};
+#endif
+
+class RgbMatrix : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        srand(1);
+        random16_set_seed(1337);
+        mock_led_config_init();
+        rgb_matrix_init();
+    }
+
+    // Runs the task until the mock driver has been flushed once more
+    void render_frame(void) {
+        uint32_t flushes = mock_flush_count;
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (int i = 0; i < 64 && mock_flush_count == flushes; i++) {
+            rgb_matrix_task();
+        }
+        ASSERT_NE(mock_flush_count, flushes);
+    }
+};
+
+// Effects keep function-local state between runs, so both the goldens and the timings depend on
+// the effects being stepped in the same order every time.
+TEST_F(RgbMatrix, GoldenFrames) {
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        SCOPED_TRACE(effect_names[mode]);
+        rgb_matrix_mode_noeeprom(mode);
+
+        size_t   event = 0;
+        uint32_t hash  = FNV1_32A_INIT;
+        for (uint8_t frame = 0; frame < GOLDEN_FRAMES; frame++) {
+            for (; event < ARRAY_SIZE(key_events) && key_events[event].frame == frame; event++) {
+                rgb_matrix_handle_key_event(key_events[event].row, key_events[event].col, key_events[event].pressed);
+            }
+            render_frame();
+            hash = fnv_32a_buf(mock_led_buffer, sizeof(mock_led_buffer), hash);
+        }
+        EXPECT_EQ(hash, golden_hashes[mode]);
+    }
+}
+
+// Disabled by default, as timings are only of interest when profiling -- run with --gtest_also_run_disabled_tests
+TEST_F(RgbMatrix, DISABLED_Benchmark) {
+    printf("%d LEDs, %d frames per effect\n", RGB_MATRIX_LED_COUNT, BENCHMARK_FRAMES);
+    for (uint8_t mode = 1; mode < RGB_MATRIX_EFFECT_MAX; mode++) {
+        rgb_matrix_mode_noeeprom(mode);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+            if (frame % 8 == 0) {
+                rgb_matrix_handle_key_event(frame % MATRIX_ROWS, frame % MATRIX_COLS, true);
+            }
+            render_frame();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        printf("  %-32s %10.0f ns/frame\n", effect_names[mode], (double)elapsed.count() / BENCHMARK_FRAMES);
+    }
+}
@@ -0,0 +1,36 @@
+rgb_matrix_common_DEFS := -DRGB_MATRIX_TESTS -DRGB_MATRIX_ENABLE -DEEPROM_TEST_HARNESS
+rgb_matrix_common_INC := \
+	$(LIB_PATH)/fnv \
+	$(QUANTUM_PATH)/rgb_matrix \
+	$(QUANTUM_PATH)/rgb_matrix/animations \
+	$(QUANTUM_PATH)/rgb_matrix/animations/runners
+rgb_matrix_common_SRC := \
+	platforms/test/timer.c \
+	platforms/test/eeprom.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/lib8tion/lib8tion.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/rgb_matrix/rgb_matrix.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/mock_driver.c \
+	$(QUANTUM_PATH)/rgb_matrix/tests/rgb_matrix_tests.cpp
+
+rgb_matrix_60_DEFS := $(rgb_matrix_common_DEFS)
+rgb_matrix_60_INC := $(rgb_matrix_common_INC)
+rgb_matrix_60_CONFIG := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/config_mock_60.h \
+	$(QUANTUM_PATH)/rgb_matrix/post_config.h
+rgb_matrix_60_SRC := $(rgb_matrix_common_SRC)
+
+rgb_matrix_100_DEFS := $(rgb_matrix_common_DEFS)
+rgb_matrix_100_INC := $(rgb_matrix_common_INC)
+rgb_matrix_100_CONFIG := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/config_mock_100.h \
+	$(QUANTUM_PATH)/rgb_matrix/post_config.h
+rgb_matrix_100_SRC := $(rgb_matrix_common_SRC)
+
+rgb_matrix_150_DEFS := $(rgb_matrix_common_DEFS)
+rgb_matrix_150_INC := $(rgb_matrix_common_INC)
+rgb_matrix_150_CONFIG := \
+	$(QUANTUM_PATH)/rgb_matrix/tests/config_mock_150.h \
+	$(QUANTUM_PATH)/rgb_matrix/post_config.h
+rgb_matrix_150_SRC := $(rgb_matrix_common_SRC)
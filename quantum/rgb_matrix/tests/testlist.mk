@@ -0,0 +1,4 @@
+TEST_LIST += \
+	rgb_matrix_60 \
+	rgb_matrix_100 \
+	rgb_matrix_150
@@ -33,6 +33,10 @@
 #include "wait.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 
+#if defined(EEPROM_STATS_ENABLE) && defined(EEPROM_DRIVER)
+#    include "eeprom_driver.h"
+#endif
+
 #if defined(AUDIO_ENABLE)
 #    include "audio.h"
 #endif
@@ -865,3 +869,43 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(EEPROM_STATS_ENABLE) && defined(EEPROM_DRIVER)
+
+void via_eeprom_stats_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    // value_id is the eeprom_stat_t, value_data[0] the region index where applicable
+    uint8_t *command_id = &(data[0]);
+    uint8_t *value_id   = &(data[2]);
+    uint8_t *value_data = &(data[3]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            // Any write resets all of the counters
+            eeprom_driver_reset_stats();
+            break;
+        }
+        case id_custom_get_value: {
+            uint32_t value = 0;
+            if (!eeprom_driver_get_stat(*value_id, value_data[0], &value)) {
+                *command_id = id_unhandled;
+                break;
+            }
+            value_data[1] = (value >> 24) & 0xFF;
+            value_data[2] = (value >> 16) & 0xFF;
+            value_data[3] = (value >> 8) & 0xFF;
+            value_data[4] = value & 0xFF;
+            break;
+        }
+        case id_custom_save: {
+            // Counters are held in RAM only
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+#endif // EEPROM_STATS_ENABLE && EEPROM_DRIVER
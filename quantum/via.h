@@ -202,4 +202,10 @@ void via_qmk_audio_command(uint8_t *data, uint8_t length);
 void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
+#endif
+
+#if defined(EEPROM_STATS_ENABLE) && defined(EEPROM_DRIVER)
+// Not routed by via_custom_value_command(), as there is no VIA channel for it -- call from via_custom_value_command_kb()
+// on a keyboard-chosen channel to expose the EEPROM statistics counters.
+void via_eeprom_stats_command(uint8_t *data, uint8_t length);
 #endif
\ No newline at end of file
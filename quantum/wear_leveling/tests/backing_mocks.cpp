@@ -23,12 +23,14 @@ void MockBackingStore::reset_instance() {
     backing_erase_invoke_count  = 0;
     backing_write_invoke_count  = 0;
     backing_lock_invoke_count   = 0;
+    backing_read_invoke_count   = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
     unlock_success_callback = [](std::uint64_t) { return true; };
     write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
     lock_success_callback   = [](std::uint64_t) { return true; };
+    range_erasable_callback = [](std::uint32_t, std::uint32_t) { return true; };
 
     write_log.clear();
 }
@@ -75,6 +77,42 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase(uint32_t address, uint32_t length) {
+    // Erasing everything is handled identically to a full erase
+    if (address == 0 && length == WEAR_LEVELING_BACKING_SIZE) {
+        return erase();
+    }
+
+    ++backing_erase_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Range would result of out-of-bounds access";
+
+    // Erase each slot in the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        // Drop out of erase early with failure if we need to
+        if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count)) {
+            append_log(true);
+            return false;
+        }
+
+        backing_storage[i].erase();
+    }
+
+    // Keep track of the erase in the write log so that we can verify during tests
+    append_log(true);
+
+    ++backing_erasure_count;
+    return true;
+}
+
+bool MockBackingStore::range_erasable(uint32_t address, uint32_t length) const {
+    if (range_erasable_callback) {
+        return range_erasable_callback(address, length);
+    }
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -114,6 +152,8 @@ bool MockBackingStore::lock(void) {
 }
 
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+    ++backing_read_invoke_count;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
@@ -141,6 +181,14 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    return MockBackingStore::Instance().erase(address, length);
+}
+
+extern "C" bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    return MockBackingStore::Instance().range_erasable(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -96,6 +96,7 @@ class MockBackingStore {
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    mutable std::uint64_t backing_read_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -107,6 +108,8 @@ class MockBackingStore {
     std::function<bool(std::uint64_t, std::uint32_t)> write_success_callback;
     // Whether locks should succeed
     std::function<bool(std::uint64_t)> lock_success_callback;
+    // Whether a range can be erased on its own
+    std::function<bool(std::uint32_t, std::uint32_t)> range_erasable_callback;
 
     template <typename... Args>
     void append_log(Args&&... args) {
@@ -147,6 +150,9 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,6 +165,8 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase(std::uint32_t address, std::uint32_t length);
+    bool range_erasable(std::uint32_t address, std::uint32_t length) const;
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
@@ -179,6 +187,9 @@ class MockBackingStore {
     void set_lock_callback(std::function<bool(std::uint64_t)> callback) {
         lock_success_callback = callback;
     }
+    void set_range_erasable_callback(std::function<bool(std::uint32_t, std::uint32_t)> callback) {
+        range_erasable_callback = callback;
+    }
 
     auto storage_begin() const -> decltype(backing_storage.begin()) {
         return backing_storage.begin();
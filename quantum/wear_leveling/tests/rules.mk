@@ -63,4 +63,52 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+wear_leveling_write_back_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=64 \
+	-DWEAR_LEVELING_WRITE_BACK_DELAY=100 \
+	-DWEAR_LEVELING_WRITE_BACK_RANGES=4
+wear_leveling_write_back_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_back.cpp
+wear_leveling_write_back_INC := \
+	$(wear_leveling_common_INC)
+wear_leveling_checkpoint_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_CHECKPOINT_INTERVAL=256
+wear_leveling_checkpoint_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_checkpoint.cpp
+wear_leveling_checkpoint_INC := \
+	$(wear_leveling_common_INC)
+wear_leveling_regions_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	'-DWEAR_LEVELING_REGIONS={{64,1024},{960,3072}}'
+wear_leveling_regions_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_regions.cpp
+wear_leveling_regions_INC := \
+	$(wear_leveling_common_INC)
+wear_leveling_stats_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=48 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_STATS_ENABLE \
+	'-DWEAR_LEVELING_REGIONS={{8,24},{8,24}}'
+wear_leveling_stats_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_stats.cpp
+wear_leveling_stats_INC := \
+	$(wear_leveling_common_INC)
@@ -0,0 +1,146 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingCheckpoint : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        expected.fill(0);
+        seed = 0x12345678;
+    }
+
+    // Deterministic pseudo-random sequence, so that failures are reproducible
+    std::uint32_t next_random() {
+        seed = seed * 1664525 + 1013904223;
+        return seed >> 8;
+    }
+
+    // Writes a value to a random location, biased towards a small "hot" region as per typical keyboard usage
+    void write_random() {
+        std::uint32_t address = (next_random() % 4 == 0) ? (next_random() % (WEAR_LEVELING_LOGICAL_SIZE - 4)) : (0x100 + next_random() % 16);
+        std::uint8_t  length  = 1 + next_random() % 4;
+        std::uint8_t  value[4];
+        for (std::uint8_t i = 0; i < length; ++i) {
+            value[i] = (std::uint8_t)next_random();
+        }
+        EXPECT_NE(wear_leveling_write(address, value, length), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        std::copy(value, value + length, expected.begin() + address);
+    }
+
+    // Re-initializes from the backing store, and ensures the logical contents match what was written
+    void verify_after_init() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+        wear_leveling_read(0, actual.data(), actual.size());
+        EXPECT_EQ(actual, expected) << "Incorrect data after playback";
+    }
+
+    // Locates the most recent checkpoint marker in the backing store, by way of the mock's write log
+    std::uint32_t find_latest_marker() {
+        auto&         inst   = MockBackingStore::Instance();
+        std::uint32_t marker = 0;
+        for (auto it = inst.log_begin(); it != inst.log_end(); ++it) {
+            if (!it->erased && (it->address - (WEAR_LEVELING_LOGICAL_SIZE + 8)) % WEAR_LEVELING_CHECKPOINT_ALIGNMENT == 0 && (it->value & 0xFF) == 0xC1) {
+                marker = it->address;
+            }
+        }
+        return marker;
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+    std::uint32_t                                        seed;
+};
+
+/**
+ * This test verifies that the logical contents survive re-initialization throughout many writes, including consolidations.
+ */
+TEST_F(WearLevelingCheckpoint, DataIntegrity) {
+    auto& inst = MockBackingStore::Instance();
+    for (int i = 0; i < 4000; ++i) {
+        write_random();
+        if (i % 97 == 0) {
+            verify_after_init();
+        }
+    }
+    verify_after_init();
+    EXPECT_GT(inst.erasure_count(), 0u) << "Expected consolidation to have occurred during the test";
+}
+
+/**
+ * This test verifies that initialization reads far less of the backing store when a checkpoint is present.
+ */
+TEST_F(WearLevelingCheckpoint, InitReadsReduced) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Fill most of the write log with writes to the hot region, without triggering consolidation
+    std::uint8_t value = 0;
+    while (inst.total_write_count() < (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE) / BACKING_STORE_WRITE_SIZE - 128) {
+        ++value;
+        std::uint32_t address = 0x100 + (value % 16);
+        EXPECT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        expected[address] = value;
+    }
+    EXPECT_EQ(inst.erasure_count(), 0u) << "Consolidation occurred unexpectedly";
+    EXPECT_NE(find_latest_marker(), 0u) << "No checkpoint was written";
+
+    const std::uint64_t log_words = inst.total_write_count();
+    const std::uint64_t before    = inst.read_invoke_count();
+    verify_after_init();
+    const std::uint64_t init_reads        = inst.read_invoke_count() - before;
+    const std::uint64_t consolidate_reads = WEAR_LEVELING_LOGICAL_SIZE / BACKING_STORE_WRITE_SIZE + 8 / BACKING_STORE_WRITE_SIZE;
+
+    std::cout << "[   BENCH  ] log words: " << log_words << ", init reads: " << init_reads << " (" << consolidate_reads << " consolidated, " << (init_reads - consolidate_reads) << " log)" << std::endl;
+    RecordProperty("log_words", (int)log_words);
+    RecordProperty("init_reads", (int)init_reads);
+    EXPECT_LT(init_reads - consolidate_reads, log_words / 4) << "Checkpoint did not reduce the amount of the log played back";
+}
+
+/**
+ * This test verifies that a corrupted checkpoint marker is ignored, falling back to an earlier checkpoint or the start of the log.
+ */
+TEST_F(WearLevelingCheckpoint, CorruptMarkerIsIgnored) {
+    auto& inst = MockBackingStore::Instance();
+
+    while (find_latest_marker() == 0) {
+        write_random();
+    }
+    for (int i = 0; i < 8; ++i) {
+        write_random();
+    }
+    EXPECT_EQ(inst.erasure_count(), 0u) << "Consolidation occurred unexpectedly";
+
+    // Flip some bits of the check value in the marker, which occupies the most significant byte of its last write
+    std::uint32_t marker = find_latest_marker();
+    auto&         elem   = inst.storage_begin()[(marker + 8 - BACKING_STORE_WRITE_SIZE) / BACKING_STORE_WRITE_SIZE];
+    auto          stored = elem.get();
+    elem.erase();
+    elem.set(stored ^ ((backing_store_int_t)0x5A << (8 * (BACKING_STORE_WRITE_SIZE - 1))));
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that checkpoints are only written when the consolidated area can be relied upon.
+ */
+TEST_F(WearLevelingCheckpoint, NoCheckpointWithoutBaseline) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Corrupt the consolidated area so that its checksum no longer matches, and it isn't blank
+    auto& elem = inst.storage_begin()[0];
+    elem.erase();
+    elem.set(~(backing_store_int_t)0x1234);
+    wear_leveling_init();
+
+    for (int i = 0; i < 100; ++i) {
+        write_random();
+    }
+    EXPECT_EQ(inst.erasure_count(), 0u) << "Consolidation occurred unexpectedly";
+    EXPECT_EQ(find_latest_marker(), 0u) << "Checkpoint was written relative to an invalid consolidated area";
+    verify_after_init();
+}
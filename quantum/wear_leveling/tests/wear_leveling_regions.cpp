@@ -0,0 +1,127 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// Mirrors WEAR_LEVELING_REGIONS as configured in rules.mk
+static constexpr std::uint32_t hot_logical_size  = 64;
+static constexpr std::uint32_t hot_backing_size  = 1024;
+static constexpr std::uint32_t cold_logical_size = WEAR_LEVELING_LOGICAL_SIZE - hot_logical_size;
+
+class WearLevelingRegions : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        expected.fill(0);
+    }
+
+    void write(std::uint32_t address, const std::uint8_t* value, std::size_t length) {
+        EXPECT_NE(wear_leveling_write(address, value, length), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        std::copy(value, value + length, expected.begin() + address);
+    }
+
+    // Re-initializes from the backing store, and ensures the logical contents match what was written
+    void verify_after_init() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+        wear_leveling_read(0, actual.data(), actual.size());
+        EXPECT_EQ(actual, expected) << "Incorrect data after playback";
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+};
+
+/**
+ * This test verifies that writes to the hot region only ever consolidate the hot region's slice of the backing store.
+ */
+TEST_F(WearLevelingRegions, HotWritesDoNotWearColdRegion) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Put something in the cold region first, so that its log is non-empty
+    std::uint8_t value = 0xA5;
+    write(hot_logical_size + 0x10, &value, sizeof(value));
+
+    while (inst.erasure_count() < 3) {
+        ++value;
+        write(value % hot_logical_size, &value, sizeof(value));
+    }
+
+    std::size_t index      = 0;
+    std::size_t hot_erases = 0;
+    for (auto it = inst.storage_begin(); it != inst.storage_end(); ++it, ++index) {
+        if (index < hot_backing_size / BACKING_STORE_WRITE_SIZE) {
+            hot_erases += it->num_erases();
+        } else {
+            EXPECT_EQ(it->num_erases(), 0u) << "Cold region was erased at index " << index;
+        }
+    }
+    EXPECT_GT(hot_erases, 0u) << "Hot region was not consolidated";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that writes to the cold region are logged within the cold region's slice of the backing store.
+ */
+TEST_F(WearLevelingRegions, ColdWritesUseColdLog) {
+    auto&        inst  = MockBackingStore::Instance();
+    std::uint8_t value = 0x15;
+
+    write(hot_logical_size + 0x20, &value, sizeof(value));
+    ASSERT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Unexpected number of backing store writes";
+    EXPECT_EQ(inst.log_begin()->address, hot_backing_size + cold_logical_size + 8) << "Write was not logged at the start of the cold region's log";
+
+    verify_after_init();
+}
+
+/**
+ * This test verifies that writes spanning the region boundary are split correctly, and survive playback and consolidation.
+ */
+TEST_F(WearLevelingRegions, WritesSpanningRegions) {
+    auto&                       inst = MockBackingStore::Instance();
+    std::array<std::uint8_t, 8> value;
+
+    for (int i = 0; i < 1000; ++i) {
+        for (std::size_t j = 0; j < value.size(); ++j) {
+            value[j] = (std::uint8_t)(i + j);
+        }
+        write(hot_logical_size - 4 + (i % 3), value.data(), value.size());
+        if (i % 101 == 0) {
+            verify_after_init();
+        }
+    }
+    EXPECT_GT(inst.erasure_count(), 0u) << "Expected consolidation to have occurred during the test";
+    verify_after_init();
+}
+
+/**
+ * This test verifies that an erase clears every region.
+ */
+TEST_F(WearLevelingRegions, EraseClearsAllRegions) {
+    std::uint8_t value = 0x15;
+    write(0x02, &value, sizeof(value));
+    write(hot_logical_size + 0x02, &value, sizeof(value));
+
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    expected.fill(0);
+    verify_after_init();
+}
+
+/**
+ * This test verifies that regions which can't be erased independently are rejected before anything is erased.
+ */
+TEST_F(WearLevelingRegions, MisalignedRegionsRejected) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Erase granularity larger than the hot region's slice
+    inst.set_range_erasable_callback([](std::uint32_t address, std::uint32_t length) { return address % 2048 == 0 && length % 2048 == 0; });
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init accepted misaligned regions";
+    EXPECT_EQ(inst.erasure_count(), 0u) << "Backing store was erased";
+
+    // Erase granularity matching the regions
+    inst.set_range_erasable_callback([](std::uint32_t address, std::uint32_t length) { return address % 1024 == 0 && length % 1024 == 0; });
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init rejected aligned regions";
+}
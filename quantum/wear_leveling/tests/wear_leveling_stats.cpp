@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class WearLevelingStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        set_time(0);
+        wear_leveling_init();
+        wear_leveling_reset_stats();
+    }
+};
+
+/**
+ * This test verifies that logical writes, skipped writes and log entries are counted.
+ */
+TEST_F(WearLevelingStats, WritesAreCounted) {
+    wear_leveling_stats_t stats;
+    uint8_t               test_value = 0x15;
+
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    wear_leveling_get_stats(&stats);
+    EXPECT_EQ(stats.logical_writes, 2u) << "Incorrect number of logical writes";
+    EXPECT_EQ(stats.skipped_writes, 1u) << "Unchanged write was not counted as skipped";
+    EXPECT_EQ(stats.log_entries, (uint32_t)std::distance(MockBackingStore::Instance().log_begin(), MockBackingStore::Instance().log_end())) << "Log entries do not match backing store writes";
+    EXPECT_EQ(stats.consolidations, 0u) << "Consolidation counted unexpectedly";
+}
+
+/**
+ * This test verifies that the log fill percentage tracks the write log, and consolidation only erases the affected region.
+ */
+TEST_F(WearLevelingStats, ConsolidationAndLogFill) {
+    wear_leveling_stats_t        stats;
+    wear_leveling_region_stats_t region_stats[2];
+    uint8_t                      test_value = 0;
+
+    ASSERT_TRUE(wear_leveling_get_region_stats(0, &region_stats[0])) << "Missing region";
+    EXPECT_EQ(region_stats[0].log_fill, 0) << "Write log was not empty";
+
+    // Fill half of the first region's write log
+    const uint32_t log_words = (24 - 8 - 8) / BACKING_STORE_WRITE_SIZE;
+    for (uint32_t i = 0; i < log_words / 2; ++i) {
+        ++test_value;
+        wear_leveling_write(0x00, &test_value, sizeof(test_value));
+    }
+    wear_leveling_get_region_stats(0, &region_stats[0]);
+    EXPECT_EQ(region_stats[0].log_fill, 50) << "Incorrect log fill percentage";
+
+    // Fill the rest, forcing a consolidation
+    for (uint32_t i = 0; i < log_words / 2; ++i) {
+        ++test_value;
+        wear_leveling_write(0x00, &test_value, sizeof(test_value));
+    }
+    wear_leveling_get_stats(&stats);
+    wear_leveling_get_region_stats(0, &region_stats[0]);
+    wear_leveling_get_region_stats(1, &region_stats[1]);
+    EXPECT_EQ(stats.consolidations, 1u) << "Consolidation was not counted";
+    EXPECT_EQ(region_stats[0].erase_cycles, 1u) << "Region erase was not counted";
+    EXPECT_EQ(region_stats[1].erase_cycles, 0u) << "Unaffected region erase was counted";
+    EXPECT_EQ(region_stats[0].log_fill, 0) << "Write log was not emptied";
+
+    EXPECT_FALSE(wear_leveling_get_region_stats(2, &region_stats[0])) << "Non-existent region was reported";
+}
+
+/**
+ * This test verifies that a full erase counts against every region.
+ */
+TEST_F(WearLevelingStats, EraseIsCounted) {
+    wear_leveling_stats_t        stats;
+    wear_leveling_region_stats_t region_stats;
+
+    wear_leveling_erase();
+    wear_leveling_get_stats(&stats);
+    EXPECT_EQ(stats.erases, 1u) << "Erase was not counted";
+    for (uint8_t i = 0; wear_leveling_get_region_stats(i, &region_stats); ++i) {
+        EXPECT_EQ(region_stats.erase_cycles, 1u) << "Erase was not counted against region " << (int)i;
+    }
+}
+
+/**
+ * This test verifies that a failed erase is not counted.
+ */
+TEST_F(WearLevelingStats, FailedEraseIsNotCounted) {
+    wear_leveling_stats_t        stats;
+    wear_leveling_region_stats_t region_stats;
+
+    MockBackingStore::Instance().set_erase_callback([](std::uint64_t) { return false; });
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_FAILED) << "Erase did not fail";
+    wear_leveling_get_stats(&stats);
+    EXPECT_EQ(stats.erases, 0u) << "Failed erase was counted";
+    for (uint8_t i = 0; wear_leveling_get_region_stats(i, &region_stats); ++i) {
+        EXPECT_EQ(region_stats.erase_cycles, 0u) << "Failed erase was counted against region " << (int)i;
+    }
+}
+
+/**
+ * This test verifies that time spent with the backing store unlocked is accumulated.
+ */
+TEST_F(WearLevelingStats, BackingTimeIsAccumulated) {
+    auto&                 inst = MockBackingStore::Instance();
+    wear_leveling_stats_t stats;
+    uint8_t               test_value = 0x15;
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) {
+        advance_time(3);
+        return true;
+    });
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    wear_leveling_get_stats(&stats);
+    EXPECT_EQ(stats.backing_time, 3u) << "Incorrect time spent with the backing store unlocked";
+
+    wear_leveling_reset_stats();
+    wear_leveling_get_stats(&stats);
+    EXPECT_EQ(stats.backing_time, 0u) << "Counters were not reset";
+    EXPECT_EQ(stats.logical_writes, 0u) << "Counters were not reset";
+}
@@ -0,0 +1,187 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+extern "C" {
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class WearLevelingWriteBack : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        set_time(0);
+        wear_leveling_init();
+    }
+};
+
+/**
+ * This test verifies that writes only update the cache, and nothing reaches the backing store until flushed.
+ */
+TEST_F(WearLevelingWriteBack, WritesAreDeferred) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+    uint8_t read_value = 0;
+
+    EXPECT_EQ(wear_leveling_write(0x02, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Backing store was written before flush";
+    EXPECT_EQ(inst.unlock_invoke_count(), 0u) << "Backing store was unlocked before flush";
+
+    EXPECT_EQ(wear_leveling_read(0x02, &read_value, sizeof(read_value)), WEAR_LEVELING_SUCCESS) << "Read returned incorrect status";
+    EXPECT_EQ(read_value, test_value) << "Cache was not updated";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Flush did not write to the backing store";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1u) << "Flush did not unlock the backing store exactly once";
+    EXPECT_TRUE(inst.is_locked()) << "Flush did not relock the backing store";
+
+    // Nothing more is pending
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Second flush wrote to the backing store";
+}
+
+/**
+ * This test verifies that the task only flushes once writes have stopped for the configured delay.
+ */
+TEST_F(WearLevelingWriteBack, TaskFlushesAfterQuietPeriod) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    advance_time(WEAR_LEVELING_WRITE_BACK_DELAY - 1);
+    wear_leveling_task();
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Task flushed before the delay elapsed";
+
+    // Another write restarts the quiet period
+    test_value = 0x16;
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    advance_time(WEAR_LEVELING_WRITE_BACK_DELAY - 1);
+    wear_leveling_task();
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Task flushed before the delay elapsed";
+
+    advance_time(1);
+    wear_leveling_task();
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Task did not flush after the delay elapsed";
+
+    // Re-init, and ensure only the last value made it to the backing store
+    uint8_t read_value = 0;
+    wear_leveling_init();
+    wear_leveling_read(0x02, &read_value, sizeof(read_value));
+    EXPECT_EQ(read_value, 0x16) << "Incorrect value after playback";
+}
+
+/**
+ * This test verifies that overlapping and adjacent writes are coalesced into a single range.
+ */
+TEST_F(WearLevelingWriteBack, OverlappingWritesAreCoalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Write 4 bytes at 0x10, then rewrite the middle and extend it on each side
+    std::array<std::uint8_t, 4> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    wear_leveling_write(0x10, testvalue.data(), testvalue.size());
+    std::iota(testvalue.begin(), testvalue.end(), 0x30);
+    wear_leveling_write(0x12, testvalue.data(), testvalue.size());
+    std::iota(testvalue.begin(), testvalue.end(), 0x40);
+    wear_leveling_write(0x0C, testvalue.data(), testvalue.size());
+
+    // 0x0C..0x15 inclusive is 10 bytes, which requires two multi-byte log entries
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 2) << "Writes were not coalesced";
+
+    // Re-init, and ensure the data is correct after playback
+    std::array<std::uint8_t, 10> expected = {0x40, 0x41, 0x42, 0x43, 0x20, 0x21, 0x30, 0x31, 0x32, 0x33};
+    std::array<std::uint8_t, 10> actual;
+    wear_leveling_init();
+    wear_leveling_read(0x0C, actual.data(), actual.size());
+    EXPECT_EQ(actual, expected) << "Incorrect data after playback";
+}
+
+/**
+ * This test verifies that running out of dirty ranges flushes the pending ranges, and keeps the newest write pending.
+ */
+TEST_F(WearLevelingWriteBack, RangeExhaustionFlushes) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    // Write to distinct, non-adjacent addresses to fill the dirty range set
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        EXPECT_EQ(wear_leveling_write(i * 2, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Backing store was written before range exhaustion";
+
+    // One more forces the existing ranges out
+    EXPECT_EQ(wear_leveling_write(WEAR_LEVELING_WRITE_BACK_RANGES * 2, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), WEAR_LEVELING_WRITE_BACK_RANGES) << "Pending ranges were not flushed";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), WEAR_LEVELING_WRITE_BACK_RANGES + 1) << "Newest write was not flushed";
+}
+
+/**
+ * This test verifies that a write which fails to flush the exhausted dirty ranges is still kept pending, rather than
+ * being lost from the backing store while remaining in the cache.
+ */
+TEST_F(WearLevelingWriteBack, RangeExhaustionFlushFailure) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    for (uint32_t i = 0; i < WEAR_LEVELING_WRITE_BACK_RANGES; ++i) {
+        wear_leveling_write(i * 2, &test_value, sizeof(test_value));
+    }
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    EXPECT_EQ(wear_leveling_write(0x20, &test_value, sizeof(test_value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Backing store was written despite failure";
+
+    // Rewriting the same value is skipped, as the cache already holds it, so it must already be pending
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_EQ(wear_leveling_write(0x20, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    // Re-init, and ensure every write made it to the backing store
+    wear_leveling_init();
+    for (uint32_t address : {0x00, 0x02, 0x04, 0x06, 0x20}) {
+        uint8_t read_value = 0;
+        wear_leveling_read(address, &read_value, sizeof(read_value));
+        EXPECT_EQ(read_value, test_value) << "Write to 0x" << std::hex << address << " was lost";
+    }
+}
+
+/**
+ * This test verifies that pending writes are discarded by an erase.
+ */
+TEST_F(WearLevelingWriteBack, EraseDiscardsPendingWrites) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    wear_leveling_erase();
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Pending write survived erase";
+    EXPECT_TRUE(inst.log_begin()->erased) << "Expected only the erase in the log";
+}
+
+/**
+ * This test verifies that a failed flush leaves the data pending, so that it is written on a subsequent flush.
+ */
+TEST_F(WearLevelingWriteBack, FailedFlushIsRetried) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    wear_leveling_write(0x02, &test_value, sizeof(test_value));
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return false; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Backing store was written despite failure";
+
+    EXPECT_TRUE(inst.is_locked()) << "Flush did not relock the backing store after failure";
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t) { return true; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 1) << "Pending write was not retried";
+}
@@ -5,6 +5,10 @@
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
 
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0 || defined(WEAR_LEVELING_STATS_ENABLE)
+#    include "timer.h"
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0 || defined(WEAR_LEVELING_STATS_ENABLE)
+
 /*
     This wear leveling algorithm is adapted from algorithms from previous
     implementations in QMK, namely:
@@ -61,12 +65,45 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_WRITE_BACK_DELAY: If non-zero, writes only update the
+            cache and are flushed to the write log once no further writes have
+            occurred for this many milliseconds, or when explicitly requested.
+
+        - WEAR_LEVELING_WRITE_BACK_RANGES: The number of distinct dirty address
+            ranges tracked in write-back mode. If exhausted, the pending ranges
+            are flushed immediately.
+
+        - WEAR_LEVELING_CHECKPOINT_INTERVAL: If non-zero, a checkpoint is
+            considered once this many bytes of the write log need to be played
+            back during initialization.
+
+        - WEAR_LEVELING_CHECKPOINT_ALIGNMENT: The alignment of checkpoint
+            markers within the write log, relative to the start of the log.
+
+        - WEAR_LEVELING_REGIONS: An initializer list of
+            { logical size, backing size } pairs, splitting the logical data and
+            backing store into independent regions laid out contiguously, in
+            order. Each region has its own consolidated data and write log, and
+            is consolidated separately, so frequently-written data can be kept
+            apart from rarely-written data. Each region must satisfy the same
+            size constraints as a whole backing store, and each region's backing
+            slice must be aligned to the backing store's erase granularity.
+            Addresses within write log entries are relative to the start of the
+            region. Defaults to a single region covering everything.
+
+        - WEAR_LEVELING_STATS_ENABLE: If defined, counters for writes, log
+            entries, consolidations, erase cycles and time spent with the
+            backing store unlocked are maintained in RAM, and can be retrieved
+            with wear_leveling_get_stats() and wear_leveling_get_region_stats().
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
+            * If checkpoints are enabled, the latest valid checkpoint marker is
+                located.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly, starting from the checkpoint if one was found.
 
         During reads:
             * Logical data is served from the cache.
@@ -76,6 +113,13 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During writes, if write-back is enabled:
+            * The cache is updated with the new data.
+            * The written address range is merged into the set of dirty ranges.
+            * Once the write-back delay has elapsed, or on an explicit flush,
+                the current cached contents of each dirty range are appended to
+                the log as per a normal write.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -153,17 +197,130 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Checkpoints:
+
+        Playing back the write log takes longer the fuller it gets. If enabled,
+        once enough of the log has been written a checkpoint is appended: the
+        differences between the cache and the consolidated data are written as
+        normal log entries (the "summary"), followed by a marker recording where
+        the summary starts. Playback can then start from the summary of the
+        latest marker rather than from the start of the log, as the summary
+        together with everything after it reproduces the current cache.
+
+        Markers are only ever written at WEAR_LEVELING_CHECKPOINT_ALIGNMENT
+        offsets from the start of the log, with padding entries inserted before
+        them as required -- initialization only needs to inspect those offsets.
+        As other entries may also occupy those offsets, each marker includes a
+        check value derived from its own location and contents. A marker is
+        written only after its summary, so if power is lost part-way through a
+        checkpoint the previous checkpoint remains valid.
+
+        ╔Padding═╗
+        ║11000000║
+        ║  └─┬──┘║
+        ║  Kind  ║
+        ╚════════╝
+        Occupies a single backing store write.
+
+        ╔ Checkpoint Marker ════════════════════════════════════════════════════╗
+        ║11000001║XXXXXXXX║XXXXXXXX║XXXXXXXX║CCCCCCCC║CCCCCCCC║CCCCCCCC║CCCCCCCC║
+        ║  └─┬──┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║
+        ║  Kind  ║ Offset ║ Offset ║ Offset ║ Check  ║ Check  ║ Check  ║ Check  ║
+        ╚════════╩════════╩════════╩════════╩════════╩════════╩════════╩════════╝
+        The offset is the start of the summary in backing store writes,
+        relative to the start of the log. The check value is the FNV1a_32 of the
+        marker's address followed by its first four bytes. Both are stored least
+        significant byte first. */
+
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+/**
+ * A range of logical addresses which have been written to the cache but not yet to the backing store.
+ */
+typedef struct wear_leveling_dirty_range_t {
+    uint32_t start;
+    uint32_t end; // exclusive
+} wear_leveling_dirty_range_t;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+
+/**
+ * Layout of the regions, as configured.
+ */
+static const wear_leveling_region_config_t wear_leveling_region_config[] = WEAR_LEVELING_REGIONS;
+
+#define WEAR_LEVELING_REGION_COUNT (sizeof(wear_leveling_region_config) / sizeof(wear_leveling_region_config[0]))
+
+/**
+ * State of an individual region. Backing store addresses are absolute, logical addresses within the write log are relative to the start of the region.
+ */
+typedef struct wear_leveling_region_t {
+    uint32_t logical_start;
+    uint32_t logical_size;
+    uint32_t backing_start;
+    uint32_t backing_size;
+    uint32_t write_address;
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    bool     baseline_valid;     // consolidated area matches the cache contents as of init
+    uint32_t playback_address;   // where playback would start on the next init
+    uint32_t checkpoint_attempt; // write address of the last checkpoint consideration
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    uint32_t erase_cycles; // number of times the region's slice of the backing store has been erased
+#endif // WEAR_LEVELING_STATS_ENABLE
+} wear_leveling_region_t;
 
 /**
  * Storage area for the wear-leveling cache.
  */
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
-    uint32_t                                                       write_address;
+    wear_leveling_region_t                                         regions[WEAR_LEVELING_REGION_COUNT];
     bool                                                           unlocked;
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    wear_leveling_dirty_range_t                                    dirty_ranges[(WEAR_LEVELING_WRITE_BACK_RANGES)];
+    uint8_t                                                        dirty_count;
+    uint32_t                                                       last_write;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    wear_leveling_stats_t                                          stats;
+    uint32_t                                                       unlock_time;
+#endif // WEAR_LEVELING_STATS_ENABLE
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_STATS_ENABLE
+#    define wl_stats_add(field, value) (wear_leveling.stats.field += (value))
+#else // WEAR_LEVELING_STATS_ENABLE
+#    define wl_stats_add(field, value) \
+        do {                           \
+        } while (0)
+#endif // WEAR_LEVELING_STATS_ENABLE
+
+/**
+ * Backing store address of the start of a region's write log, directly after its consolidated data.
+ */
+static inline uint32_t wear_leveling_log_start(const wear_leveling_region_t *region) {
+    return region->backing_start + region->logical_size + 8; // +8 due to the FNV1a_64 of the consolidated area
+}
+
+/**
+ * Backing store address of the end of a region's write log.
+ */
+static inline uint32_t wear_leveling_log_end(const wear_leveling_region_t *region) {
+    return region->backing_start + region->backing_size;
+}
+
+/**
+ * Finds the region containing the supplied logical address.
+ */
+static wear_leveling_region_t *wear_leveling_region_for(uint32_t address) {
+    wear_leveling_region_t *region = &wear_leveling.regions[0];
+    while (address >= region->logical_start + region->logical_size && region < &wear_leveling.regions[WEAR_LEVELING_REGION_COUNT - 1]) {
+        ++region;
+    }
+    return region;
+}
+
 /**
  * Locking helper: status
  */
@@ -180,6 +337,9 @@ static inline backing_store_lock_status_t wear_leveling_unlock(void) {
         return STATUS_FAILURE;
     }
     wear_leveling.unlocked = true;
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    wear_leveling.unlock_time = timer_read32();
+#endif // WEAR_LEVELING_STATS_ENABLE
     return STATUS_SUCCESS;
 }
 
@@ -194,71 +354,138 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
         return STATUS_FAILURE;
     }
     wear_leveling.unlocked = false;
+    wl_stats_add(backing_time, timer_elapsed32(wear_leveling.unlock_time));
     return STATUS_SUCCESS;
 }
 
 /**
- * Resets the cache, ensuring the write address is correctly initialised.
+ * Resets a region's portion of the cache, ensuring the write address is correctly initialised.
+ */
+static void wear_leveling_clear_region(wear_leveling_region_t *region) {
+    memset(&wear_leveling.cache[region->logical_start], 0, region->logical_size);
+    region->write_address = wear_leveling_log_start(region);
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    region->baseline_valid     = false;
+    region->playback_address   = region->write_address;
+    region->checkpoint_attempt = region->write_address;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+}
+
+/**
+ * Resets the cache, ensuring the write addresses are correctly initialised.
  */
 static void wear_leveling_clear_cache(void) {
-    memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+        wear_leveling_clear_region(&wear_leveling.regions[i]);
+    }
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    wear_leveling.dirty_count = 0;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
 }
 
 /**
- * Reads the consolidated data from the backing store into the cache.
+ * Lays out the regions consecutively in both the logical and backing spaces. Requires the backing store to have been
+ * initialised, as each region's slice must be erasable on its own.
+ *
+ * @return false if the configured regions are invalid
+ */
+static bool wear_leveling_layout_regions(void) {
+    uint32_t logical_start = 0;
+    uint32_t backing_start = 0;
+    for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+        const wear_leveling_region_config_t *config = &wear_leveling_region_config[i];
+        wear_leveling_region_t *             region = &wear_leveling.regions[i];
+        if (config->logical_size == 0 || config->logical_size % (BACKING_STORE_WRITE_SIZE) != 0 || config->backing_size % (BACKING_STORE_WRITE_SIZE) != 0 || config->backing_size < config->logical_size * 2) {
+            wl_dprintf("Invalid configuration for region %d\n", (int)i);
+            return false;
+        }
+        // Consolidation erases the region's slice, which must not touch any other region -- catch this now rather than on the first consolidation
+        if (!backing_store_range_erasable(backing_start, config->backing_size)) {
+            wl_dprintf("Region %d is not aligned to the backing store's erase boundaries\n", (int)i);
+            return false;
+        }
+        region->logical_start = logical_start;
+        region->logical_size  = config->logical_size;
+        region->backing_start = backing_start;
+        region->backing_size  = config->backing_size;
+        logical_start += config->logical_size;
+        backing_start += config->backing_size;
+    }
+
+    // The regions must exactly cover the logical space, and fit within the backing store
+    wl_assert(logical_start == (WEAR_LEVELING_LOGICAL_SIZE) && backing_start <= (WEAR_LEVELING_BACKING_SIZE));
+    return logical_start == (WEAR_LEVELING_LOGICAL_SIZE) && backing_start <= (WEAR_LEVELING_BACKING_SIZE);
+}
+
+/**
+ * Reads a region's consolidated data from the backing store into the cache.
  * Does not consider the write log.
  */
-static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+static wear_leveling_status_t wear_leveling_read_consolidated(wear_leveling_region_t *region) {
     wl_dprintf("Reading consolidated data\n");
 
+    uint8_t *              cache  = &wear_leveling.cache[region->logical_start];
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(region->backing_start, (backing_store_int_t *)cache, region->logical_size / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
 
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        uint64_t          expected = fnv_64a_buf(cache, region->logical_size, FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
 #if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+        backing_store_read_bulk(region->backing_start + region->logical_size, entry.raw16, 4);
 #elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+        backing_store_read_bulk(region->backing_start + region->logical_size, entry.raw32, 2);
 #elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
+        backing_store_read(region->backing_start + region->logical_size, &entry.raw64);
 #endif
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+            region->baseline_valid = true;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
-            wear_leveling_clear_cache();
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+            // Checkpoints are relative to the consolidated area, so can only be used if it matches the cleared cache
+            bool blank = true;
+            for (size_t i = 0; i < region->logical_size && blank; ++i) {
+                blank = cache[i] == 0;
+            }
+            wear_leveling_clear_region(region);
+            region->baseline_valid = blank;
+#else  // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+            wear_leveling_clear_region(region);
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
         }
     }
 
     // If we failed for any reason, then clear the cache
     if (status == WEAR_LEVELING_FAILED) {
-        wear_leveling_clear_cache();
+        wear_leveling_clear_region(region);
     }
 
     return status;
 }
 
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
+ * Writes a region's portion of the current cache to consolidated data at the beginning of its backing store slice.
  * Does not clear the write log.
  * Pre-condition: this is just after an erase, so we can write directly without reading.
  */
-static wear_leveling_status_t wear_leveling_write_consolidated(void) {
+static wear_leveling_status_t wear_leveling_write_consolidated(wear_leveling_region_t *region) {
     wl_dprintf("Writing consolidated data\n");
 
+    uint8_t *                   cache       = &wear_leveling.cache[region->logical_start];
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(region->backing_start, (backing_store_int_t *)cache, region->logical_size / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -266,21 +493,21 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
         write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        entry.raw64 = fnv_64a_buf(cache, region->logical_size, FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
         do {
 #if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
+            if (!backing_store_write_bulk(region->backing_start + region->logical_size, entry.raw16, 4)) {
                 status = WEAR_LEVELING_FAILED;
                 break;
             }
 #elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
+            if (!backing_store_write_bulk(region->backing_start + region->logical_size, entry.raw32, 2)) {
                 status = WEAR_LEVELING_FAILED;
                 break;
             }
 #elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
+            if (!backing_store_write(region->backing_start + region->logical_size, entry.raw64)) {
                 status = WEAR_LEVELING_FAILED;
                 break;
             }
@@ -295,28 +522,39 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 }
 
 /**
- * Forces a write of the current cache.
- * Erases the backing store, including the write log.
+ * Forces a write of a region's portion of the current cache.
+ * Erases the region's slice of the backing store, including the write log. Other regions are left untouched.
  * During this operation, there is the potential for data loss if a power loss occurs.
  */
-static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+static wear_leveling_status_t wear_leveling_consolidate_force(wear_leveling_region_t *region) {
     wl_dprintf("Erasing backing store\n");
 
     // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
-    bool ok = backing_store_erase();
+    bool ok = backing_store_erase_range(region->backing_start, region->backing_size);
     if (!ok) {
         wl_dprintf("Failed to erase backing store\n");
         return WEAR_LEVELING_FAILED;
     }
+    wl_stats_add(consolidations, 1);
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    ++region->erase_cycles;
+#endif // WEAR_LEVELING_STATS_ENABLE
 
-    // Write the cache to the first section of the backing store.
-    wear_leveling_status_t status = wear_leveling_write_consolidated();
+    // Write the cache to the first section of the region.
+    wear_leveling_status_t status = wear_leveling_write_consolidated(region);
     if (status == WEAR_LEVELING_FAILED) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
-    // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    // Next write of the log occurs after the consolidated values at the start of the region.
+    region->write_address = wear_leveling_log_start(region);
+
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    // The write log is now empty, so playback starts at the beginning of the log
+    region->baseline_valid     = status != WEAR_LEVELING_FAILED;
+    region->playback_address   = region->write_address;
+    region->checkpoint_attempt = region->write_address;
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
 
     return status;
 }
@@ -328,9 +566,9 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
-        return wear_leveling_consolidate_force();
+static wear_leveling_status_t wear_leveling_consolidate_if_needed(wear_leveling_region_t *region) {
+    if (region->write_address >= wear_leveling_log_end(region)) {
+        return wear_leveling_consolidate_force(region);
     }
 
     return WEAR_LEVELING_SUCCESS;
@@ -341,14 +579,15 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+static wear_leveling_status_t wear_leveling_append_raw(wear_leveling_region_t *region, backing_store_int_t value) {
+    bool ok = backing_store_write(region->write_address, value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
-    wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
-    return wear_leveling_consolidate_if_needed();
+    region->write_address += (BACKING_STORE_WRITE_SIZE);
+    wl_stats_add(log_entries, 1);
+    return wear_leveling_consolidate_if_needed(region);
 }
 
 /**
@@ -356,7 +595,7 @@ static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value
  *
  * @return true if consolidation occurred
  */
-static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address, const void *value, size_t length) {
+static wear_leveling_status_t wear_leveling_write_raw_multibyte(wear_leveling_region_t *region, uint32_t address, const void *value, size_t length) {
     const uint8_t *   p   = value;
     write_log_entry_t log = LOG_ENTRY_MAKE_MULTIBYTE(address, length);
     for (size_t i = 0; i < length; ++i) {
@@ -366,43 +605,43 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     // Write to the backing store. See the multi-byte log format in the documentation header at the top of the file.
     wear_leveling_status_t status;
 #if BACKING_STORE_WRITE_SIZE == 2
-    status = wear_leveling_append_raw(log.raw16[0]);
+    status = wear_leveling_append_raw(region, log.raw16[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
-    status = wear_leveling_append_raw(log.raw16[1]);
+    status = wear_leveling_append_raw(region, log.raw16[1]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
     if (length > 1) {
-        status = wear_leveling_append_raw(log.raw16[2]);
+        status = wear_leveling_append_raw(region, log.raw16[2]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 
     if (length > 3) {
-        status = wear_leveling_append_raw(log.raw16[3]);
+        status = wear_leveling_append_raw(region, log.raw16[3]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 4
-    status = wear_leveling_append_raw(log.raw32[0]);
+    status = wear_leveling_append_raw(region, log.raw32[0]);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
 
     if (length > 1) {
-        status = wear_leveling_append_raw(log.raw32[1]);
+        status = wear_leveling_append_raw(region, log.raw32[1]);
         if (status != WEAR_LEVELING_SUCCESS) {
             return status;
         }
     }
 #elif BACKING_STORE_WRITE_SIZE == 8
-    status = wear_leveling_append_raw(log.raw64);
+    status = wear_leveling_append_raw(region, log.raw64);
     if (status != WEAR_LEVELING_SUCCESS) {
         return status;
     }
@@ -411,9 +650,10 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
 }
 
 /**
- * Handles the actual writing of logical data into the write log section of the backing store.
+ * Handles the actual writing of logical data into the write log section of a region's backing store slice.
+ * The address is relative to the start of the region.
  */
-static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const void *value, size_t length) {
+static wear_leveling_status_t wear_leveling_write_raw(wear_leveling_region_t *region, uint32_t address, const void *value, size_t length) {
     const uint8_t *        p         = value;
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
@@ -424,7 +664,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
             const uint16_t v = ((uint16_t)p[1]) << 8 | p[0]; // don't just dereference a uint16_t here -- if unaligned it generates faults on some MCUs
             if (v == 0 || v == 1) {
                 const write_log_entry_t log = LOG_ENTRY_MAKE_WORD_01(address, v);
-                status                      = wear_leveling_append_raw(log.raw16[0]);
+                status                      = wear_leveling_append_raw(region, log.raw16[0]);
                 if (status != WEAR_LEVELING_SUCCESS) {
                     // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                     // If a failure occurred, pass it on.
@@ -441,7 +681,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         // Small-write optimizations - address<64:
         if (address < 64) {
             const write_log_entry_t log = LOG_ENTRY_MAKE_OPTIMIZED_64(address, *p);
-            status                      = wear_leveling_append_raw(log.raw16[0]);
+            status                      = wear_leveling_append_raw(region, log.raw16[0]);
             if (status != WEAR_LEVELING_SUCCESS) {
                 // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
                 // If a failure occurred, pass it on.
@@ -455,7 +695,7 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
         }
 #endif // BACKING_STORE_WRITE_SIZE == 2
         const size_t this_length = remaining >= LOG_ENTRY_MULTIBYTE_MAX_BYTES ? LOG_ENTRY_MULTIBYTE_MAX_BYTES : remaining;
-        status                   = wear_leveling_write_raw_multibyte(address, p, this_length);
+        status                   = wear_leveling_write_raw_multibyte(region, address, p, this_length);
         if (status != WEAR_LEVELING_SUCCESS) {
             // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
             // If a failure occurred, pass it on.
@@ -470,15 +710,20 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 }
 
 /**
- * "Replays" the write log from the backing store, updating the local cache with updated values.
+ * "Replays" a region's write log from the backing store, updating the local cache with updated values.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
+static wear_leveling_status_t wear_leveling_playback_log(wear_leveling_region_t *region) {
     wl_dprintf("Playback write log\n");
 
+    uint8_t *              cache           = &wear_leveling.cache[region->logical_start];
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    uint32_t               address         = region->playback_address;
+#else  // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    uint32_t               address         = wear_leveling_log_start(region);
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    while (!cancel_playback && address < wear_leveling_log_end(region)) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
         if (!ok) {
@@ -521,7 +766,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 const uint32_t a = LOG_ENTRY_MULTIBYTE_GET_ADDRESS(log);
                 const uint8_t  l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
 
-                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                if (a + l > region->logical_size) {
                     cancel_playback = true;
                     status          = WEAR_LEVELING_FAILED;
                     break;
@@ -561,35 +806,49 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #endif
 
-                memcpy(&wear_leveling.cache[a], &log.raw8[3], l);
+                memcpy(&cache[a], &log.raw8[3], l);
             } break;
 #if BACKING_STORE_WRITE_SIZE == 2
             case LOG_ENTRY_TYPE_OPTIMIZED_64: {
                 const uint32_t a = LOG_ENTRY_OPTIMIZED_64_GET_ADDRESS(log);
                 const uint8_t  v = LOG_ENTRY_OPTIMIZED_64_GET_VALUE(log);
 
-                if (a >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                if (a >= region->logical_size) {
                     cancel_playback = true;
                     status          = WEAR_LEVELING_FAILED;
                     break;
                 }
 
-                wear_leveling.cache[a] = v;
+                cache[a] = v;
             } break;
             case LOG_ENTRY_TYPE_WORD_01: {
                 const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
                 const uint8_t  v = LOG_ENTRY_WORD_01_GET_VALUE(log);
 
-                if (a + 1 >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                if (a + 1 >= region->logical_size) {
                     cancel_playback = true;
                     status          = WEAR_LEVELING_FAILED;
                     break;
                 }
 
-                wear_leveling.cache[a + 0] = v;
-                wear_leveling.cache[a + 1] = 0;
+                cache[a + 0] = v;
+                cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_EXTENDED: {
+                switch (LOG_ENTRY_EXTENDED_GET_KIND(log)) {
+                    case LOG_ENTRY_EXTENDED_PADDING:
+                        break;
+                    case LOG_ENTRY_EXTENDED_CHECKPOINT:
+                        // Contents are only relevant when searching for checkpoints, so skip over the rest of the marker
+                        address += 8 - (BACKING_STORE_WRITE_SIZE);
+                        break;
+                    default:
+                        cancel_playback = true;
+                        status          = WEAR_LEVELING_FAILED;
+                        break;
+                }
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -598,27 +857,307 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     }
 
     // We've reached the end of the log, so we're at the new write location
-    wear_leveling.write_address = address;
+    region->write_address = address;
 
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
-        status = wear_leveling_consolidate_force();
+        status = wear_leveling_consolidate_force(region);
     } else {
         // Consolidate the cache + write log if required
-        status = wear_leveling_consolidate_if_needed();
+        status = wear_leveling_consolidate_if_needed(region);
     }
 
     return status;
 }
 
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+/**
+ * Computes the check value stored in a checkpoint marker, tying its contents to the location it was written.
+ */
+static uint32_t wear_leveling_checkpoint_check(uint32_t marker_address, const write_log_entry_t *marker) {
+    return fnv_32a_buf((void *)marker->raw8, 4, fnv_32a_buf(&marker_address, sizeof(marker_address), FNV1_32A_INIT));
+}
+
+/**
+ * Searches the aligned locations within a region's write log for the latest valid checkpoint marker, and if found starts playback from its summary.
+ */
+static wear_leveling_status_t wear_leveling_find_checkpoint(wear_leveling_region_t *region) {
+    wl_dprintf("Searching for checkpoints\n");
+
+    const uint32_t log_start = wear_leveling_log_start(region);
+    for (uint32_t address = log_start; address + 8 <= wear_leveling_log_end(region); address += (WEAR_LEVELING_CHECKPOINT_ALIGNMENT)) {
+        write_log_entry_t marker = {.raw64 = 0};
+#if BACKING_STORE_WRITE_SIZE == 2
+        bool ok = backing_store_read(address, &marker.raw16[0]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+        bool ok = backing_store_read(address, &marker.raw32[0]);
+#elif BACKING_STORE_WRITE_SIZE == 8
+        bool ok = backing_store_read(address, &marker.raw64);
+#endif
+        if (!ok) {
+            wl_dprintf("Failed to load from backing store\n");
+            return WEAR_LEVELING_FAILED;
+        }
+
+        // Anything else at this location is a normal log entry, or an empty slot
+        if (LOG_ENTRY_GET_TYPE(marker) != LOG_ENTRY_TYPE_EXTENDED || LOG_ENTRY_EXTENDED_GET_KIND(marker) != LOG_ENTRY_EXTENDED_CHECKPOINT) {
+            continue;
+        }
+
+#if BACKING_STORE_WRITE_SIZE == 2
+        ok = backing_store_read_bulk(address + (BACKING_STORE_WRITE_SIZE), &marker.raw16[1], 3);
+#elif BACKING_STORE_WRITE_SIZE == 4
+        ok = backing_store_read(address + (BACKING_STORE_WRITE_SIZE), &marker.raw32[1]);
+#endif
+        if (!ok) {
+            wl_dprintf("Failed to load from backing store\n");
+            return WEAR_LEVELING_FAILED;
+        }
+
+        const uint32_t summary = log_start + LOG_ENTRY_CHECKPOINT_GET_OFFSET(marker) * (BACKING_STORE_WRITE_SIZE);
+        if (LOG_ENTRY_CHECKPOINT_GET_CHECK(marker) != wear_leveling_checkpoint_check(address, &marker) || summary > address) {
+            wl_dprintf("Ignoring invalid checkpoint marker at 0x%04X\n", (int)address);
+            continue;
+        }
+
+        // Later markers supersede earlier ones
+        wl_dprintf("Found checkpoint marker at 0x%04X, summary at 0x%04X\n", (int)address, (int)summary);
+        region->playback_address = summary;
+    }
+
+    region->checkpoint_attempt = region->playback_address;
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Compares a region's portion of the cache against its consolidated area, either estimating the number of bytes needed
+ * to encode the differences, or appending them to the write log.
+ * Pre-condition: the backing store is unlocked, if writing.
+ */
+static wear_leveling_status_t wear_leveling_checkpoint_diff(wear_leveling_region_t *region, bool write, uint32_t *estimate) {
+    const uint8_t *        cache = &wear_leveling.cache[region->logical_start];
+    backing_store_int_t    chunk[32 / sizeof(backing_store_int_t)];
+    uint32_t               run_start = 0;
+    bool                   in_run    = false;
+    wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
+
+    *estimate = 0;
+    for (uint32_t offset = 0; offset < region->logical_size; offset += sizeof(chunk)) {
+        const uint32_t count = (region->logical_size - offset) < sizeof(chunk) ? (region->logical_size - offset) : sizeof(chunk);
+        if (!backing_store_read_bulk(region->backing_start + offset, chunk, count / sizeof(backing_store_int_t))) {
+            wl_dprintf("Failed to load from backing store\n");
+            return WEAR_LEVELING_FAILED;
+        }
+
+        // Scan one byte past the end of the cache, so that a trailing run is terminated
+        const uint8_t *consolidated = (const uint8_t *)chunk;
+        const bool     last         = offset + count >= region->logical_size;
+        for (uint32_t i = 0; i < count + (last ? 1 : 0); ++i) {
+            const uint32_t address = offset + i;
+            const bool     differs = i < count && cache[address] != consolidated[i];
+            if (differs && !in_run) {
+                run_start = address;
+                in_run    = true;
+            } else if (!differs && in_run) {
+                const uint32_t length = address - run_start;
+                *estimate += ((length + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * 8;
+                if (write) {
+                    status = wear_leveling_write_raw(region, run_start, &cache[run_start], length);
+                    if (status != WEAR_LEVELING_SUCCESS) {
+                        // If consolidation occurred, the checkpoint is no longer needed. If a failure occurred, pass it on.
+                        return status;
+                    }
+                }
+                in_run = false;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Potential write of a checkpoint to the write log.
+ * Skipped if not enough of the write log has been written since playback would start, or if a summary of the differences
+ * from the consolidated area would not be meaningfully shorter than the log it replaces.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_checkpoint_if_needed(wear_leveling_region_t *region) {
+    const uint32_t since = region->playback_address > region->checkpoint_attempt ? region->playback_address : region->checkpoint_attempt;
+    if (!region->baseline_valid || region->write_address - since < (WEAR_LEVELING_CHECKPOINT_INTERVAL)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Don't reconsider until another interval's worth of the log has been written
+    region->checkpoint_attempt = region->write_address;
+
+    uint32_t               estimate;
+    wear_leveling_status_t status = wear_leveling_checkpoint_diff(region, false, &estimate);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
+    // Allow for the worst-case padding plus the marker itself
+    const uint32_t cost = estimate + (WEAR_LEVELING_CHECKPOINT_ALIGNMENT) + 8;
+    if (cost >= region->write_address - region->playback_address || region->write_address + cost > wear_leveling_log_end(region)) {
+        wl_dprintf("Skipping checkpoint, summary would be too large\n");
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Writing checkpoint\n");
+
+    // Write the summary. Should any of the following trigger consolidation, the checkpoint is no longer needed.
+    const uint32_t summary = region->write_address;
+    status                 = wear_leveling_checkpoint_diff(region, true, &estimate);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
+    // Pad until the marker is aligned
+    const uint32_t    log_start = wear_leveling_log_start(region);
+    write_log_entry_t padding   = LOG_ENTRY_MAKE_PADDING();
+    while ((region->write_address - log_start) % (WEAR_LEVELING_CHECKPOINT_ALIGNMENT) != 0) {
+#if BACKING_STORE_WRITE_SIZE == 2
+        status = wear_leveling_append_raw(region, padding.raw16[0]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+        status = wear_leveling_append_raw(region, padding.raw32[0]);
+#elif BACKING_STORE_WRITE_SIZE == 8
+        status = wear_leveling_append_raw(region, padding.raw64);
+#endif
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+    }
+
+    // Write the marker, only after which will the summary be used
+    const uint32_t    offset = (summary - log_start) / (BACKING_STORE_WRITE_SIZE);
+    write_log_entry_t marker = LOG_ENTRY_MAKE_CHECKPOINT(offset, 0);
+    marker                   = LOG_ENTRY_MAKE_CHECKPOINT(offset, wear_leveling_checkpoint_check(region->write_address, &marker));
+#if BACKING_STORE_WRITE_SIZE == 2
+    for (int i = 0; i < 4 && status == WEAR_LEVELING_SUCCESS; ++i) {
+        status = wear_leveling_append_raw(region, marker.raw16[i]);
+    }
+#elif BACKING_STORE_WRITE_SIZE == 4
+    for (int i = 0; i < 2 && status == WEAR_LEVELING_SUCCESS; ++i) {
+        status = wear_leveling_append_raw(region, marker.raw32[i]);
+    }
+#elif BACKING_STORE_WRITE_SIZE == 8
+    status = wear_leveling_append_raw(region, marker.raw64);
+#endif
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
+    region->playback_address   = summary;
+    region->checkpoint_attempt = region->write_address;
+    return status;
+}
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+
+/**
+ * Appends the cached contents of the supplied logical address range to the write logs of the regions it spans,
+ * consolidating each region if required.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_write_range(uint32_t start, uint32_t end) {
+    wear_leveling_status_t result = WEAR_LEVELING_SUCCESS;
+    while (start < end) {
+        wear_leveling_region_t *region     = wear_leveling_region_for(start);
+        const uint32_t          region_end = region->logical_start + region->logical_size;
+        const uint32_t          this_end   = end < region_end ? end : region_end;
+
+        wear_leveling_status_t status = wear_leveling_write_raw(region, start - region->logical_start, &wear_leveling.cache[start], this_end - start);
+        if (status == WEAR_LEVELING_SUCCESS) {
+            // Consolidate the cache + write log if required
+            status = wear_leveling_consolidate_if_needed(region);
+        }
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+        if (status == WEAR_LEVELING_SUCCESS) {
+            status = wear_leveling_checkpoint_if_needed(region);
+        }
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+
+        // If consolidation occurred, then the region's cache has already been written to its consolidated area, but any
+        // other regions still need to be written. If a failure occurred, pass it on.
+        if (status == WEAR_LEVELING_FAILED) {
+            return status;
+        }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            result = status;
+        }
+        start = this_end;
+    }
+
+    return result;
+}
+
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+/**
+ * Merges the supplied range into the set of dirty ranges, absorbing any ranges it overlaps or abuts.
+ *
+ * @return false if there was no space left to record the range
+ */
+static bool wear_leveling_mark_dirty(uint32_t start, uint32_t end) {
+    uint8_t i = 0;
+    while (i < wear_leveling.dirty_count) {
+        wear_leveling_dirty_range_t *range = &wear_leveling.dirty_ranges[i];
+        if (range->start <= end && start <= range->end) {
+            // Absorb the existing range, then remove it by moving the last range into its slot
+            start  = range->start < start ? range->start : start;
+            end    = range->end > end ? range->end : end;
+            *range = wear_leveling.dirty_ranges[--wear_leveling.dirty_count];
+            // The grown range may now reach ranges which were already checked, so start again
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+
+    if (wear_leveling.dirty_count >= (WEAR_LEVELING_WRITE_BACK_RANGES)) {
+        return false;
+    }
+
+    wear_leveling.dirty_ranges[wear_leveling.dirty_count++] = (wear_leveling_dirty_range_t){.start = start, .end = end};
+    return true;
+}
+
+/**
+ * Appends the cached contents of all dirty ranges to the write log, consolidating if required.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_write_dirty(void) {
+    wear_leveling_status_t result = WEAR_LEVELING_SUCCESS;
+    while (wear_leveling.dirty_count > 0) {
+        const wear_leveling_dirty_range_t *range = &wear_leveling.dirty_ranges[wear_leveling.dirty_count - 1];
+        wl_dprintf("Flushing dirty range [0x%04X, 0x%04X)\n", (int)range->start, (int)range->end);
+        wear_leveling_status_t status = wear_leveling_write_range(range->start, range->end);
+        if (status == WEAR_LEVELING_FAILED) {
+            // Leave the range marked as dirty so that it's retried on the next flush
+            return status;
+        }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            result = status;
+            if (WEAR_LEVELING_REGION_COUNT == 1) {
+                // The entire cache has been written to the consolidated area, so nothing else is pending.
+                wear_leveling.dirty_count = 0;
+                break;
+            }
+        }
+        --wear_leveling.dirty_count;
+    }
+
+    return result;
+}
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+
 /**
  * Wear-leveling initialization
  */
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
-
-    // Reset the cache
-    wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    uint32_t start = timer_read32();
+#endif // WEAR_LEVELING_STATS_ENABLE
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -627,22 +1166,53 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
-    // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
-    if (status == WEAR_LEVELING_FAILED) {
-        // If it failed, clear the cache and return with failure
-        wear_leveling_clear_cache();
-        return status;
+    // Work out where each region lives
+    if (!wear_leveling_layout_regions()) {
+        return WEAR_LEVELING_FAILED;
     }
 
-    status = wear_leveling_playback_log();
-    if (status == WEAR_LEVELING_FAILED) {
-        // If it failed, clear the cache and return with failure
-        wear_leveling_clear_cache();
-        return status;
+    // Reset the cache
+    wear_leveling_clear_cache();
+
+    wear_leveling_status_t result = WEAR_LEVELING_SUCCESS;
+    for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+        wear_leveling_region_t *region = &wear_leveling.regions[i];
+
+        // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
+        wear_leveling_status_t status = wear_leveling_read_consolidated(region);
+        if (status == WEAR_LEVELING_FAILED) {
+            // If it failed, clear the cache and return with failure
+            wear_leveling_clear_cache();
+            return status;
+        }
+
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+        // Skip as much of the write log as possible, if the consolidated area can be relied upon
+        if (region->baseline_valid) {
+            status = wear_leveling_find_checkpoint(region);
+            if (status == WEAR_LEVELING_FAILED) {
+                // If it failed, clear the cache and return with failure
+                wear_leveling_clear_cache();
+                return status;
+            }
+        }
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+
+        status = wear_leveling_playback_log(region);
+        if (status == WEAR_LEVELING_FAILED) {
+            // If it failed, clear the cache and return with failure
+            wear_leveling_clear_cache();
+            return status;
+        }
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            result = status;
+        }
     }
 
-    return status;
+#ifdef WEAR_LEVELING_STATS_ENABLE
+    wear_leveling.stats.init_time = timer_elapsed32(start);
+#endif // WEAR_LEVELING_STATS_ENABLE
+    return result;
 }
 
 /**
@@ -662,6 +1232,19 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+    if (ret) {
+        wl_stats_add(erases, 1);
+#ifdef WEAR_LEVELING_STATS_ENABLE
+        for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+            ++wear_leveling.regions[i].erase_cycles;
+        }
+#endif // WEAR_LEVELING_STATS_ENABLE
+    }
+#if WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
+    for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+        wear_leveling.regions[i].baseline_valid = ret;
+    }
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL > 0
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -682,15 +1265,34 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
 
     wl_dprintf("Write ");
     wl_dump(address, value, length);
+    wl_stats_add(logical_writes, 1);
 
     // Skip write if there's no change compared to the current cached value
     if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
+        wl_stats_add(skipped_writes, 1);
         return true;
     }
 
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    // Defer the write to the backing store until the writes quieten down
+    wear_leveling.last_write = timer_read32();
+    if (wear_leveling_mark_dirty(address, address + length)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Out of dirty ranges -- flush what's pending, which leaves space for this write
+    wear_leveling_status_t status = wear_leveling_flush();
+    if (!wear_leveling_mark_dirty(address, address + length)) {
+        // The flush failed without making space. The cache already holds this write, so rather than lose it, widen the
+        // most recent range to cover it -- rewriting the unchanged data in between is harmless.
+        wear_leveling_dirty_range_t range = wear_leveling.dirty_ranges[--wear_leveling.dirty_count];
+        wear_leveling_mark_dirty(range.start < address ? range.start : address, range.end > address + length ? range.end : address + length);
+    }
+    return status;
+#else  // WEAR_LEVELING_WRITE_BACK_DELAY > 0
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -699,24 +1301,39 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
-    switch (status) {
-        case WEAR_LEVELING_CONSOLIDATED:
-        case WEAR_LEVELING_FAILED:
-            // If the write triggered consolidation, or the write failed, then nothing else needs to occur.
-            break;
+    wear_leveling_status_t status = wear_leveling_write_range(address, address + length);
 
-        case WEAR_LEVELING_SUCCESS:
-            // Consolidate the cache + write log if required
-            status = wear_leveling_consolidate_if_needed();
-            break;
-
-        default:
-            // Unsure how we'd get here...
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
             status = WEAR_LEVELING_FAILED;
-            break;
+        }
     }
 
+    return status;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+}
+
+/**
+ * Writes any pending write-back data to the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    if (wear_leveling.dirty_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Perform the actual writes
+    wear_leveling_status_t status = wear_leveling_write_dirty();
+
     if (lock_status == STATUS_SUCCESS) {
         if (wear_leveling_lock() == STATUS_FAILURE) {
             status = WEAR_LEVELING_FAILED;
@@ -724,6 +1341,20 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#else  // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
+}
+
+/**
+ * Periodic task, flushing pending write-back data once writes have quietened down.
+ */
+void wear_leveling_task(void) {
+#if WEAR_LEVELING_WRITE_BACK_DELAY > 0
+    if (wear_leveling.dirty_count > 0 && timer_elapsed32(wear_leveling.last_write) >= (WEAR_LEVELING_WRITE_BACK_DELAY)) {
+        wear_leveling_flush();
+    }
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY > 0
 }
 
 /**
@@ -743,6 +1374,42 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_STATS_ENABLE
+/**
+ * Retrieves the accumulated counters.
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t *stats) {
+    *stats = wear_leveling.stats;
+}
+
+/**
+ * Retrieves the counters and current state of an individual region.
+ */
+bool wear_leveling_get_region_stats(uint8_t index, wear_leveling_region_stats_t *stats) {
+    if (index >= WEAR_LEVELING_REGION_COUNT) {
+        return false;
+    }
+
+    const wear_leveling_region_t *region   = &wear_leveling.regions[index];
+    uint32_t                      log_size = wear_leveling_log_end(region) - wear_leveling_log_start(region);
+    stats->logical_size                    = region->logical_size;
+    stats->backing_size                    = region->backing_size;
+    stats->erase_cycles                    = region->erase_cycles;
+    stats->log_fill                        = log_size ? (uint8_t)((uint64_t)(region->write_address - wear_leveling_log_start(region)) * 100 / log_size) : 100;
+    return true;
+}
+
+/**
+ * Resets the accumulated counters.
+ */
+void wear_leveling_reset_stats(void) {
+    memset(&wear_leveling.stats, 0, sizeof(wear_leveling.stats));
+    for (size_t i = 0; i < WEAR_LEVELING_REGION_COUNT; ++i) {
+        wear_leveling.regions[i].erase_cycles = 0;
+    }
+}
+#endif // WEAR_LEVELING_STATS_ENABLE
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -766,3 +1433,24 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of the erase granularity check, matching the weak ranged erase below by only accepting the
+ * entire backing store. Drivers implementing ranged erase must implement this too, so that multiple regions are
+ * accepted, and misaligned regions are rejected up front.
+ */
+__attribute__((weak)) bool backing_store_range_erasable(uint32_t address, uint32_t length) {
+    return address == 0 && length == (WEAR_LEVELING_BACKING_SIZE);
+}
+
+/**
+ * Weak implementation of ranged erase, only capable of erasing the entire backing store. Drivers must implement this,
+ * along with backing_store_range_erasable(), to support multiple regions.
+ */
+__attribute__((weak)) bool backing_store_erase_range(uint32_t address, uint32_t length) {
+    if (address != 0 || length != (WEAR_LEVELING_BACKING_SIZE)) {
+        bs_dprintf("Erasing a subset of the backing store is unsupported\n");
+        return false;
+    }
+    return backing_store_erase();
+}
@@ -1,9 +1,15 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+// EEPROM statistics rely on the wear-leveling counters
+#if defined(EEPROM_STATS_ENABLE) && !defined(WEAR_LEVELING_STATS_ENABLE)
+#    define WEAR_LEVELING_STATS_ENABLE
+#endif
+
 /**
  * @typedef Status returned from any wear-leveling API.
  */
@@ -13,6 +19,29 @@ typedef enum wear_leveling_status_t {
     WEAR_LEVELING_CONSOLIDATED //< Invocation succeeded, consolidation occurred
 } wear_leveling_status_t;
 
+/**
+ * @typedef Counters accumulated since power-on, or since the last wear_leveling_reset_stats().
+ */
+typedef struct wear_leveling_stats_t {
+    uint32_t logical_writes; //< Number of calls to wear_leveling_write()
+    uint32_t skipped_writes; //< Number of writes skipped as the data was unchanged
+    uint32_t log_entries;    //< Number of entries appended to the write log, in units of the backing store write size
+    uint32_t consolidations; //< Number of times a region's write log filled up and was consolidated
+    uint32_t erases;         //< Number of calls to wear_leveling_erase()
+    uint32_t backing_time;   //< Milliseconds spent with the backing store unlocked for writes and erases
+    uint32_t init_time;      //< Milliseconds taken by the last wear_leveling_init()
+} wear_leveling_stats_t;
+
+/**
+ * @typedef Counters and current state of an individual region.
+ */
+typedef struct wear_leveling_region_stats_t {
+    uint32_t logical_size; //< Size of the region's logical data
+    uint32_t backing_size; //< Size of the region's slice of the backing store
+    uint32_t erase_cycles; //< Number of times every sector in the region's slice of the backing store has been erased
+    uint8_t  log_fill;     //< Percentage of the region's write log currently in use
+} wear_leveling_region_stats_t;
+
 /**
  * Wear-leveling initialization
  *
@@ -36,6 +65,9 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * If write-back is enabled through WEAR_LEVELING_WRITE_BACK_DELAY, only the cache is updated and the written range is
+ * recorded as dirty -- the backing store is written by a subsequent wear_leveling_flush() or wear_leveling_task().
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -52,3 +84,40 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Writes any pending write-back data to the backing store.
+ *
+ * All dirty ranges are appended to the write log within a single unlock/lock of the backing store. Does nothing if
+ * write-back is disabled, or if there is no pending data.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Periodic task, flushing pending write-back data once no writes have occurred for WEAR_LEVELING_WRITE_BACK_DELAY
+ * milliseconds. Does nothing if write-back is disabled.
+ */
+void wear_leveling_task(void);
+
+/**
+ * Retrieves the counters accumulated since power-on. Requires WEAR_LEVELING_STATS_ENABLE.
+ *
+ * @param stats[out] the destination for the counters
+ */
+void wear_leveling_get_stats(wear_leveling_stats_t* stats);
+
+/**
+ * Retrieves the counters and current state of a region. Requires WEAR_LEVELING_STATS_ENABLE.
+ *
+ * @param index[in] the index of the region, as ordered within WEAR_LEVELING_REGIONS
+ * @param stats[out] the destination for the counters
+ * @return true if the region exists
+ */
+bool wear_leveling_get_region_stats(uint8_t index, wear_leveling_region_stats_t* stats);
+
+/**
+ * Resets all accumulated counters to zero. Requires WEAR_LEVELING_STATS_ENABLE.
+ */
+void wear_leveling_reset_stats(void);
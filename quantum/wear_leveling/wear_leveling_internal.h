@@ -27,6 +27,37 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifndef WEAR_LEVELING_WRITE_BACK_DELAY
+#    define WEAR_LEVELING_WRITE_BACK_DELAY 0
+#endif // WEAR_LEVELING_WRITE_BACK_DELAY
+
+#ifndef WEAR_LEVELING_WRITE_BACK_RANGES
+#    define WEAR_LEVELING_WRITE_BACK_RANGES 8
+#endif // WEAR_LEVELING_WRITE_BACK_RANGES
+
+#ifndef WEAR_LEVELING_CHECKPOINT_INTERVAL
+#    define WEAR_LEVELING_CHECKPOINT_INTERVAL 0
+#endif // WEAR_LEVELING_CHECKPOINT_INTERVAL
+
+#ifndef WEAR_LEVELING_CHECKPOINT_ALIGNMENT
+#    define WEAR_LEVELING_CHECKPOINT_ALIGNMENT 64
+#endif // WEAR_LEVELING_CHECKPOINT_ALIGNMENT
+
+/**
+ * Size of an individual wear-leveling region, within both the logical and backing spaces.
+ */
+typedef struct wear_leveling_region_config_t {
+    uint32_t logical_size;
+    uint32_t backing_size;
+} wear_leveling_region_config_t;
+
+// Regions are laid out consecutively, in order, from the start of both the logical and backing spaces.
+// Defaults to a single region covering everything.
+#ifndef WEAR_LEVELING_REGIONS
+#    define WEAR_LEVELING_REGIONS \
+        { {(WEAR_LEVELING_LOGICAL_SIZE), (WEAR_LEVELING_BACKING_SIZE)} }
+#endif // WEAR_LEVELING_REGIONS
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -65,11 +96,15 @@ typedef uint64_t backing_store_int_t;
 _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_WRITE_BACK_RANGES > 0 && WEAR_LEVELING_WRITE_BACK_RANGES <= 255, "Write-back range count must be between 1 and 255");
+_Static_assert(WEAR_LEVELING_CHECKPOINT_ALIGNMENT % 8 == 0, "Checkpoint alignment must be a multiple of 8");
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, uint32_t length); // weak implementation already provided which only supports erasing everything, required by driver for multiple regions
+bool backing_store_range_erasable(uint32_t address, uint32_t length); // weak implementation already provided which only accepts the entire backing store, implemented alongside backing_store_erase_range()
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
@@ -101,6 +136,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Entries which do not carry logical data, such as padding and checkpoint markers
+    LOG_ENTRY_TYPE_EXTENDED,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +187,42 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+/**
+ * Extended log entry kind discriminator.
+ */
+enum {
+    // 0x00 -- Padding, occupying a single backing store write
+    LOG_ENTRY_EXTENDED_PADDING,
+
+    // 0x01 -- Checkpoint marker, occupying 8 bytes
+    LOG_ENTRY_EXTENDED_CHECKPOINT,
+};
+
+#define LOG_ENTRY_EXTENDED_GET_KIND(entry) ((uint8_t)((entry).raw8[0] & BITMASK_FOR_BITCOUNT(6)))
+#define LOG_ENTRY_MAKE_PADDING()                                                                       \
+    (write_log_entry_t) {                                                                              \
+        .raw8 = {                                                                                      \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_EXTENDED) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */    \
+                   | (((uint8_t)LOG_ENTRY_EXTENDED_PADDING) & BITMASK_FOR_BITCOUNT(6))   /* kind */    \
+                   ),                                                                                  \
+        }                                                                                              \
+    }
+
+#define LOG_ENTRY_CHECKPOINT_GET_OFFSET(entry) ((((uint32_t)((entry).raw8[3])) << 16) | (((uint32_t)((entry).raw8[2])) << 8) | (entry).raw8[1])
+#define LOG_ENTRY_CHECKPOINT_GET_CHECK(entry) ((((uint32_t)((entry).raw8[7])) << 24) | (((uint32_t)((entry).raw8[6])) << 16) | (((uint32_t)((entry).raw8[5])) << 8) | (entry).raw8[4])
+#define LOG_ENTRY_MAKE_CHECKPOINT(offset, check)                                                       \
+    (write_log_entry_t) {                                                                              \
+        .raw8 = {                                                                                      \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_EXTENDED) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */    \
+                   | (((uint8_t)LOG_ENTRY_EXTENDED_CHECKPOINT) & BITMASK_FOR_BITCOUNT(6)) /* kind */   \
+                   ),                                                                                  \
+            [1] = (uint8_t)(offset),         /* offset */                                              \
+            [2] = (uint8_t)((offset) >> 8),  /* offset */                                              \
+            [3] = (uint8_t)((offset) >> 16), /* offset */                                              \
+            [4] = (uint8_t)(check),          /* check */                                               \
+            [5] = (uint8_t)((check) >> 8),   /* check */                                               \
+            [6] = (uint8_t)((check) >> 16),  /* check */                                               \
+            [7] = (uint8_t)((check) >> 24),  /* check */                                               \
+        }                                                                                              \
+    }